@@ -1,2 +1,93 @@
 Import("env")
-env.Replace( MKSPIFFSTOOL=env.get("PROJECT_DIR") + '/mklittlefs' )
+
+# Listed twice in platformio.ini: as a pre script it stages the web assets
+# before the platform binds the filesystem image to the data directory, as
+# a post script it swaps in the LittleFS image tool the platform replaced.
+#
+# Staging copies data/ to $BUILD_DIR/littlefs_data and
+# - rewrites references between assets to /<path>?v=<hash>, so the server
+#   can let browsers cache them for a year
+# - stores compressible assets gzipped only, as <path>.gz
+# - writes /assets.idx with one "<path> <etag> <gzip>" line per asset,
+#   which the firmware reads once to answer with ETag and Content-Encoding
+
+import gzip
+import hashlib
+import os
+import re
+import shutil
+
+ASSET_INDEX = "assets.idx"
+# the firmware reads config.json itself, it stays as it is
+PLAIN = ("config.json",)
+COMPRESS = (".html", ".css", ".js", ".ico", ".svg")
+# assets that reference others, they are hashed after what they refer to
+REFERRERS = (".css", ".html")
+
+
+def etag_of(content):
+    return hashlib.sha256(content).hexdigest()[:16]
+
+
+def rewrite_references(text, hashes):
+    for rel, etag in hashes.items():
+        text = re.sub(r'(["\'(])/?' + re.escape(rel) + r'(["\')])',
+                      r'\g<1>/' + rel + '?v=' + etag + r'\g<2>', text)
+    return text
+
+
+def stage_assets(source, target):
+    if os.path.isdir(target):
+        shutil.rmtree(target)
+    files = []
+    for root, _, names in os.walk(source):
+        for name in names:
+            files.append(os.path.relpath(os.path.join(root, name), source).replace(os.sep, "/"))
+    # leaves first, then stylesheets, then pages
+    files.sort(key=lambda rel: REFERRERS.index(os.path.splitext(rel)[1]) + 1
+               if os.path.splitext(rel)[1] in REFERRERS else 0)
+
+    hashes = {}
+    index = []
+    raw_total = stored_total = 0
+    for rel in files:
+        with open(os.path.join(source, rel), "rb") as f:
+            content = f.read()
+        dest = os.path.join(target, rel)
+        os.makedirs(os.path.dirname(dest), exist_ok=True)
+        if rel in PLAIN:
+            with open(dest, "wb") as f:
+                f.write(content)
+            continue
+
+        if rel.endswith(REFERRERS):
+            content = rewrite_references(content.decode("utf-8"), hashes).encode("utf-8")
+        compress = rel.endswith(COMPRESS)
+        if compress:
+            # mtime 0 keeps the output and its hash stable between builds
+            content_stored = gzip.compress(content, 9, mtime=0)
+            dest += ".gz"
+        else:
+            content_stored = content
+        with open(dest, "wb") as f:
+            f.write(content_stored)
+
+        etag = etag_of(content_stored)
+        hashes[rel] = etag
+        index.append("/%s %s %d\n" % (rel, etag, 1 if compress else 0))
+        raw_total += len(content)
+        stored_total += len(content_stored)
+
+    with open(os.path.join(target, ASSET_INDEX), "w") as f:
+        f.writelines(index)
+    print("Staged %d web assets, %d bytes as %d bytes" % (len(index), raw_total, stored_total))
+
+
+if env.get("MKSPIFFSTOOL") is None:
+    fs_targets = set(["buildfs", "uploadfs", "uploadfsota"])
+    if fs_targets & set(COMMAND_LINE_TARGETS):
+        staging = os.path.join(env.subst("$BUILD_DIR"), "littlefs_data")
+        stage_assets(env.subst("$PROJECT_DATA_DIR"), staging)
+        env.Replace(PROJECT_DATA_DIR=staging)
+else:
+    env.Replace( MKSPIFFSTOOL=env.get("PROJECT_DIR") + '/mklittlefs' )
@@ -0,0 +1,228 @@
+# Builds include/WebUI.h, the control page as one gzipped PROGMEM array that
+# the firmware serves without touching the file system, the same way
+# WebSerialPro embeds its page.
+#
+# data/index.html is inlined with everything it loads:
+# - Materialize CSS is trimmed to the rules whose selectors can match the page
+# - Materialize JS is replaced by the one thing the page needs from it,
+#   floating the labels of the input fields
+# - the icon font is replaced by SVG paths for the icons the page uses
+# - the favicon becomes a data URI
+#
+# Runs as a pre script on every build and regenerates the header only when
+# one of its inputs changed. Without PlatformIO: python3 WebUIBuilder.py
+
+import base64
+import gzip
+import hashlib
+import os
+import re
+from html.parser import HTMLParser
+
+DATA = "data"
+OUTPUT = os.path.join("include", "WebUI.h")
+INPUTS = ("index.html", "css/materialize.min.css", "favicon.ico")
+
+# Material Icons, Apache License 2.0
+ICONS = {
+    "autorenew": "M12 6v3l4-4-4-4v3c-4.42 0-8 3.58-8 8 0 1.57.46 3.03 1.24 4.26L6.7 14.8c-.45-.83-.7-1.79-.7-2.8 0-3.31 2.69-6 6-6zm6.76 1.74L17.3 9.2c.44.84.7 1.79.7 2.8 0 3.31-2.69 6-6 6v-3l-4 4 4 4v-3c4.42 0 8-3.58 8-8 0-1.57-.46-3.03-1.24-4.26z",
+    "cached": "M19 8l-4 4h3c0 3.31-2.69 6-6 6-1.01 0-1.97-.25-2.8-.7l-1.46 1.46C8.97 19.54 10.43 20 12 20c4.42 0 8-3.58 8-8h3l-4-4zM6 12c0-3.31 2.69-6 6-6 1.01 0 1.97.25 2.8.7l1.46-1.46C15.03 4.46 13.57 4 12 4c-4.42 0-8 3.58-8 8H1l4 4 4-4H6z",
+    "forward": "M12 8V4l8 8-8 8v-4H4V8z",
+    "save": "M17 3H5c-1.11 0-2 .9-2 2v14c0 1.1.89 2 2 2h14c1.1 0 2-.9 2-2V7l-4-4zm-5 16c-1.66 0-3-1.34-3-3s1.34-3 3-3 3 1.34 3 3-1.34 3-3 3zm3-10H5V5h10v4z",
+}
+
+ICON_CSS = ".material-icons svg{width:1em;height:1em;fill:currentColor;vertical-align:middle}"
+
+# stands in for materialize.min.js; classes set here count as used
+SHIM_JS = ('document.querySelectorAll(".input-field>label").forEach('
+           'function(l){l.classList.add("active");});')
+SHIM_CLASSES = set(["active"])
+
+STYLESHEET = re.compile(r'<link[^>]*href="/?css/materialize\.min\.css"[^>]*>')
+ICON_STYLESHEET = re.compile(r'<link[^>]*href="/?icon\.css"[^>]*>')
+SCRIPT = re.compile(r'<script[^>]*src="/?js/materialize\.min\.js"[^>]*></script>')
+ICON = re.compile(r'(<i class="material-icons[^"]*">)\s*(\w+)\s*(</i>)')
+
+
+class UsedNames(HTMLParser):
+    def __init__(self):
+        HTMLParser.__init__(self)
+        self.tags = set(["html", "body"])
+        self.classes = set(SHIM_CLASSES)
+        self.ids = set()
+
+    def handle_starttag(self, tag, attrs):
+        self.tags.add(tag)
+        for name, value in attrs:
+            if name == "class" and value:
+                self.classes.update(value.split())
+            elif name == "id" and value:
+                self.ids.add(value)
+
+
+def split_top(text, sep):
+    parts, depth, start = [], 0, 0
+    for i, c in enumerate(text):
+        if c in "([":
+            depth += 1
+        elif c in ")]":
+            depth -= 1
+        elif c == sep and depth == 0:
+            parts.append(text[start:i])
+            start = i + 1
+    parts.append(text[start:])
+    return parts
+
+
+def parse_css(css, i=0):
+    # -> ([(prelude, body or [children])], end); comments are dropped
+    nodes = []
+    while i < len(css):
+        if css.startswith("/*", i):
+            i = css.index("*/", i) + 2
+            continue
+        if css[i].isspace():
+            i += 1
+            continue
+        if css[i] == "}":
+            return nodes, i + 1
+        end = i
+        while css[end] not in "{;":
+            end += 1
+        prelude = css[i:end].strip()
+        if css[end] == ";":
+            nodes.append((prelude, None))
+            i = end + 1
+        elif re.match(r"@(media|supports)", prelude):
+            children, i = parse_css(css, end + 1)
+            nodes.append((prelude, children))
+        elif re.match(r"@(-\w+-)?keyframes", prelude):
+            close = end + 1
+            depth = 1
+            while depth:
+                depth += {"{": 1, "}": -1}.get(css[close], 0)
+                close += 1
+            nodes.append((prelude, css[end + 1:close - 1]))
+            i = close
+        else:
+            close = css.index("}", end)
+            nodes.append((prelude, css[end + 1:close]))
+            i = close + 1
+    return nodes, i
+
+
+def selector_matches(selector, used):
+    s = re.sub(r"::?[\w-]+\([^()]*(\([^()]*\)[^()]*)*\)", "", selector)
+    s = re.sub(r"\[[^\]]*\]", "", s)
+    s = re.sub(r"::?[\w-]+", "", s)
+    if not set(re.findall(r"\.([\w-]+)", s)) <= used.classes:
+        return False
+    if not set(re.findall(r"#([\w-]+)", s)) <= used.ids:
+        return False
+    for compound in re.split(r"[\s>+~]+", s.strip()):
+        tag = re.match(r"[a-zA-Z][\w-]*", compound)
+        if tag and tag.group(0).lower() not in used.tags:
+            return False
+    return True
+
+
+def trim_css(nodes, used):
+    out = []
+    for prelude, body in nodes:
+        if prelude.startswith("@"):
+            if isinstance(body, list):
+                inner = trim_css(body, used)
+                if inner:
+                    out.append(prelude + "{" + inner + "}")
+            elif re.match(r"@(-\w+-)?keyframes", prelude):
+                out.append((prelude, body))
+            elif body is not None:
+                out.append(prelude + "{" + body + "}")
+            continue
+        selectors = [s.strip() for s in split_top(prelude, ",") if selector_matches(s, used)]
+        if selectors:
+            out.append(",".join(selectors) + "{" + body + "}")
+    # keyframes survive only if a kept rule animates with them
+    rules = "".join(o for o in out if isinstance(o, str))
+    text = ""
+    for o in out:
+        if isinstance(o, tuple):
+            name = o[0].split()[-1]
+            if re.search(r"animation(-name)?:[^;}]*\b" + re.escape(name) + r"\b", rules):
+                text += o[0] + "{" + o[1] + "}"
+        else:
+            text += o
+    return text
+
+
+def minify_html(html):
+    # keep the license comment on top, drop the others
+    head, _, rest = html.partition("-->")
+    rest = re.sub(r"<!--.*?-->", "", rest, flags=re.S)
+    html = head + "-->" + rest
+    out = []
+    for part in re.split(r"(<script.*?</script>|<style.*?</style>|<textarea.*?</textarea>)", html, flags=re.S):
+        if part.startswith("<script") or part.startswith("<style"):
+            # line comments in scripts need their line breaks
+            lines = (line.strip() for line in part.split("\n"))
+            out.append("\n".join(line for line in lines if line))
+        elif part.startswith("<textarea"):
+            out.append(part)
+        else:
+            out.append(re.sub(r">\s+<", "><", re.sub(r"\s+", " ", part)))
+    return "".join(out)
+
+
+def build_page(data):
+    with open(os.path.join(data, "index.html")) as f:
+        html = minify_html(f.read())
+    used = UsedNames()
+    used.feed(html)
+    with open(os.path.join(data, "css/materialize.min.css")) as f:
+        css = f.read()
+    banner = re.match(r"/\*!.*?\*/", css, re.S).group(0)
+    css = banner + trim_css(parse_css(css)[0], used)
+    with open(os.path.join(data, "favicon.ico"), "rb") as f:
+        favicon = base64.b64encode(f.read()).decode("ascii")
+
+    def icon(m):
+        if m.group(2) not in ICONS:
+            raise Exception("WebUIBuilder.py: no SVG for icon '%s'" % m.group(2))
+        return (m.group(1) + '<svg viewBox="0 0 24 24"><path d="' + ICONS[m.group(2)] +
+                '"/></svg>' + m.group(3))
+
+    html = ICON.sub(icon, html)
+    html = ICON_STYLESHEET.sub(lambda m: "<style>" + ICON_CSS + "</style>", html)
+    html = STYLESHEET.sub(lambda m: "<style>" + css + "</style>" +
+                          '<link rel="icon" href="data:image/x-icon;base64,' + favicon + '">', html)
+    return SCRIPT.sub(lambda m: "<script>" + SHIM_JS + "</script>", html)
+
+
+def write_header(page, output):
+    # mtime 0 keeps the output and its hash stable between builds
+    blob = gzip.compress(page.encode("utf-8"), 9, mtime=0)
+    rows = [",".join(str(b) for b in blob[i:i + 30]) for i in range(0, len(blob), 30)]
+    with open(output, "w") as f:
+        f.write("// Generated by WebUIBuilder.py from data/index.html, do not edit\n\n")
+        f.write("#ifndef _WEBUI_H_INCLUDED_\n#define _WEBUI_H_INCLUDED_\n\n")
+        f.write("#define WEBUI_ETAG \"\\\"%s\\\"\"\n\n" % hashlib.sha256(blob).hexdigest()[:16])
+        f.write("const uint32_t WEBUI_HTML_SIZE = %d;\n" % len(blob))
+        f.write("const uint8_t WEBUI_HTML[] PROGMEM = {\n%s\n};\n\n" % ",\n".join(rows))
+        f.write("#endif\n")
+    print("WebUIBuilder.py: %s, %d bytes inlined, %d bytes gzipped" % (output, len(page), len(blob)))
+
+
+def build(project_dir):
+    data = os.path.join(project_dir, DATA)
+    output = os.path.join(project_dir, OUTPUT)
+    sources = [os.path.join(data, name) for name in INPUTS] + [os.path.join(project_dir, "WebUIBuilder.py")]
+    if os.path.exists(output) and os.path.getmtime(output) >= max(os.path.getmtime(s) for s in sources):
+        return
+    write_header(build_page(data), output)
+
+
+try:
+    Import("env")
+except NameError:
+    env = None
+build(env.subst("$PROJECT_DIR") if env else os.path.dirname(os.path.abspath(__file__)))
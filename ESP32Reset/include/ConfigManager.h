@@ -32,24 +32,46 @@
 #define _CONFIGMANAGER_H_INCLUDED_
 
 #include <Arduino.h>
+#include <memory>
 
 #include <Singleton.h>
 #include <Constants.h>
+#include <ConfigRecord.h>
+
+// the config as served by /getconfig; never changed once published, so a
+// response can keep sending it after a newer one replaced it
+typedef struct
+{
+  uint32_t generation;
+  char etag[12]; // quoted crc of the data
+  size_t size;
+  std::unique_ptr<char[]> data;
+} ConfigJson;
+
+typedef std::shared_ptr<const ConfigJson> ConfigJsonPtr;
 
 class ConfigManager : public Singleton <ConfigManager>
 {
   friend class Singleton <ConfigManager>;
 public:
   ~ConfigManager () { }
-  void markConfigDirty() { m_configDirty = true; }
-  void deleteConfigFile();
-  bool saveConfigToFile();
-  void setState(bool enabled);
+  // changes are written once they settle, see CONFIG_SAVE_DEBOUNCE_MS
+  void markConfigDirty();
+  void deleteConfig();
+  bool saveConfig(); // writes right away
+  bool flush() { return m_configDirty ? saveConfig() : true; }
+  void setState(uint8_t target, bool enabled);
+  // service task, writes a dirty config when it is due
+  void iterate(unsigned long currentTime);
 
   static Config* getConfigFunction(CONFIG_TYPE type);
   Config* getConfig(CONFIG_TYPE type);
 
-  char* getConfigJson(size_t &size);
+  unsigned long loadMicros() const { return m_loadMicros; }
+
+  // JSON is only produced and parsed for the web interface; serialized
+  // again only after the config changed
+  ConfigJsonPtr getConfigJson();
   void setConfigJson(const char* val);
 protected:
   ConfigManager()
@@ -59,9 +81,18 @@ protected:
 private:
 
   void init();
+  bool loadRecord();
+  bool loadJsonFile();
+  bool writeRecord(const ConfigRecord& rec);
   void printConfig();
 
-  bool m_configDirty;
+  volatile bool m_configDirty;
+  unsigned long m_dirtySince; // first change not written yet
+  unsigned long m_lastChange;
+  unsigned long m_loadMicros; // time to load the config at boot
+  int m_slot; // NVS slot of the current record, -1 for none
+  uint32_t m_generation; // counts changes of m_BoardConfig
+  ConfigJsonPtr m_json;
 
   // all config values required...
   BoardConfig m_BoardConfig;
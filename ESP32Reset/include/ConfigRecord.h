@@ -0,0 +1,102 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _CONFIGRECORD_H_INCLUDED_
+#define _CONFIGRECORD_H_INCLUDED_
+
+#include <Arduino.h>
+
+#include "Constants.h"
+
+#define CONFIG_RECORD_MAGIC         0x52433345 // "E3CR"
+#define CONFIG_RECORD_VERSION       3          // bump on any layout change
+#define CONFIG_SSID_SIZE            33         // 32 characters as in 802.11
+#define CONFIG_PWD_SIZE             65         // 64 characters for WPA2
+#define CONFIG_PATH_SIZE            48         // HTTP health check path
+
+typedef struct __attribute__((packed))
+{
+  uint8_t heartBeatPin;
+  uint8_t powerWatchPin;
+  uint8_t resetPin;
+  uint8_t powerPin;
+  uint32_t lockupTime;
+  uint32_t cooldownTime;
+  uint16_t heartBeatCnt;
+  uint8_t enabled;
+} TargetRecord;
+
+typedef struct __attribute__((packed))
+{
+  uint8_t probes;
+  uint8_t quorum;
+  uint32_t address;
+  uint16_t udpPort;
+  uint16_t httpPort;
+  char httpPath[CONFIG_PATH_SIZE];
+  uint32_t interval;
+  uint32_t udpTimeout;
+  uint32_t icmpTimeout;
+  uint32_t httpTimeout;
+} ProbeRecord;
+
+// BoardConfig as stored in NVS; the crc covers everything after itself
+typedef struct __attribute__((packed))
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  uint32_t crc;
+
+  int32_t chipId;
+  int32_t configVersion;
+  uint8_t resetWifiSettings;
+  uint16_t serverPort;
+  char hotSpotName[CONFIG_SSID_SIZE];
+  char hotSpotPwd[CONFIG_PWD_SIZE];
+  char wifiName[CONFIG_SSID_SIZE];
+  char wifiPwd[CONFIG_PWD_SIZE];
+  uint8_t targetCount;
+  TargetRecord targets[MAX_TARGETS];
+  // version 2
+  uint32_t consoleBaud;
+  // version 3
+  ProbeRecord probes[MAX_TARGETS];
+} ConfigRecord;
+
+uint32_t configCrc(const void* data, size_t size);
+// false if a string does not fit, the record is unusable then
+bool packConfig(const BoardConfig& cfg, ConfigRecord& rec);
+// false on a bad magic, version, size or crc, cfg is untouched then;
+// version 1 records end before consoleBaud and version 2 records before
+// probes, rec.size tells how much to read
+bool unpackConfig(const ConfigRecord& rec, BoardConfig& cfg);
+
+#endif // _CONFIGRECORD_H_INCLUDED_
@@ -48,6 +48,7 @@
 
 #define DEFAULT_SERVERPORT          80
 #define SERVEFROMSD                 0
+#define WEBUI_EMBEDDED              1        // serve / from flash, see WebUIBuilder.py
 
 #define DEFAULT_HOTSPOTSSID         "rock64reset"
 #define DEFAULT_HOTSPOTPWD          "rock64reset"
@@ -59,17 +60,80 @@
 
 #define FLASH_RESET_PERIOD          5000 // 5sec
 
+// pins of the first target, the others have to be configured
 #define HEARTBEAT                   16
 #define POWERWATCH                  17
 #define ROCKRESET                   14
 #define ROCKPOWER                   13
+#define PIN_UNUSED                  0xFF // e.g. a target without power watch
+
+#define MAX_TARGETS                 8   // boards supervised by one controller
+#define DEFAULT_TARGET_COUNT        1
 
 #define DEFAULT_LOCKUP_TIME                       10000 // time board is allowed to not send heartbeat
 #define DEFAULT_COOLDOWN_TIME                     120000 // time after action with no further action to be taken
 #define DEFAULT_HEARTBEAT_COUNT                   10
 
-#define CONFIGFILE_DEFAULT_SIZE           1024
-#define CONFIGFILE_DEFAULT_NAME           "/config.json"
+// ways to tell that a target is alive, TargetConfig.probes has a bit for each
+typedef enum : uint8_t
+{
+  PROBE_GPIO = 0, // heartbeat pin toggles, times out after lockupTime
+  PROBE_UDP,      // heartbeat datagrams carrying a sequence number
+  PROBE_ICMP,     // echo replies
+  PROBE_HTTP,     // 2xx answer to a GET
+  MAXPROBES
+} PROBE_TYPE;
+
+#define PROBE_BIT(type)                           (1 << (type))
+#define DEFAULT_PROBES                            PROBE_BIT(PROBE_GPIO)
+#define DEFAULT_PROBE_QUORUM                      0     // probes that must be up, 0 for all of them
+#define DEFAULT_UDP_PORT                          4210  // heartbeat datagrams of the first target
+#define DEFAULT_HTTP_PORT                         80
+#define DEFAULT_HTTP_PATH                         "/health"
+#define DEFAULT_PROBE_INTERVAL                    2000  // between pings and between health checks
+#define DEFAULT_PROBE_TIMEOUT                     10000 // a network probe is down this long after its last success
+
+// the watchdog runs alone on core 1 above everything but the WiFi stack
+// and the timers, WiFi, web, serial and the log share core 0
+#define WATCHDOG_TASK_CORE                1
+#define WATCHDOG_TASK_PRIORITY            10
+#define WATCHDOG_TASK_STACK               4096
+#define WATCHDOG_TASK_IDLE_MS             1000 // wake up at least this often
+#define SERVICE_TASK_CORE                 0
+#define SERVICE_TASK_PRIORITY             1
+#define SERVICE_TASK_STACK                8192
+
+#define LOG_STREAM_CHUNK                  1024 // max bytes of log text per server-sent event
+#define LOG_STREAM_MIN_CHUNK              32   // less room than this and the event waits for the connection
+#define LOG_STREAM_CATCHUP                100  // records a new client gets from the history
+#define SERIAL_BRIDGE_CHUNK               256  // console bytes read per call, WebSerialPro frames them
+#define SERIAL_BRIDGE_RX_BUFFER           16384 // UART driver ring, 170 ms at 921600 baud
+#define SERIAL_BRIDGE_EVENTS              32   // UART driver event queue
+#define SERIAL_BRIDGE_TX_BUFFER           8192 // browser input, one WEBSERIAL_INPUT_WINDOW per client
+#define SERIAL_BRIDGE_TX_INPUTS           64   // WebSocket fragments waiting in it
+#define SERIAL_BRIDGE_TX_OVERFLOWS        4    // clients whose input is dropped while those are full
+#define SERIAL_TASK_CORE                  0
+#define SERIAL_TASK_PRIORITY              2    // above the service task
+#define SERIAL_TASK_STACK                 4096
+#define PROBE_TASK_CORE                   0
+#define PROBE_TASK_PRIORITY               1
+#define PROBE_TASK_STACK                  4096
+#define DEFAULT_CONSOLE_BAUD              115200
+#define MIN_CONSOLE_BAUD                  9600
+#define MAX_CONSOLE_BAUD                  921600
+
+#define ASSET_INDEX_NAME                  "/assets.idx" // written by LittleFSBuilder.py
+#define ASSET_MAX_COUNT                   8
+#define ASSET_ETAG_SIZE                   17   // 16 hex digits of the content hash
+#define ASSET_CACHE_LONG                  "public, max-age=31536000, immutable"
+
+#define CONFIGFILE_DEFAULT_SIZE           8192 // room for MAX_TARGETS targets with their probes
+#define CONFIGFILE_DEFAULT_NAME           "/config.json" // migrated to NVS once
+#define CONFIG_NVS_NAMESPACE              "esp32reset"
+#define CONFIG_NVS_KEY                    "config"  // single record of earlier firmware
+#define CONFIG_NVS_SLOTS                  2         // records written in turn, the newest valid one wins
+#define CONFIG_SAVE_DEBOUNCE_MS           2000      // quiet time before a change is written
+#define CONFIG_SAVE_MAX_DELAY_MS          10000     // upper bound for a write in a burst of changes
 
 typedef enum : uint8_t
 {
@@ -80,6 +144,29 @@ typedef enum : uint8_t
 typedef struct
 {} Config;
 
+// one supervised board
+typedef struct
+{
+    uint8_t heartBeatPin = HEARTBEAT;
+    uint8_t powerWatchPin = POWERWATCH;
+    uint8_t resetPin = ROCKRESET;
+    uint8_t powerPin = ROCKPOWER;
+    int lockupTime = DEFAULT_LOCKUP_TIME;
+    int cooldownTime = DEFAULT_COOLDOWN_TIME;
+    int heartBeatCnt = DEFAULT_HEARTBEAT_COUNT;
+    bool enabled = DEFAULT_WD_ENABLED;
+    uint8_t probes = DEFAULT_PROBES; // PROBE_BIT of each probe that judges liveness
+    uint8_t quorum = DEFAULT_PROBE_QUORUM;
+    uint32_t probeAddress = 0; // IPv4 of the board in network order, for the network probes
+    uint16_t udpPort = DEFAULT_UDP_PORT;
+    uint16_t httpPort = DEFAULT_HTTP_PORT;
+    String httpPath = DEFAULT_HTTP_PATH;
+    int probeInterval = DEFAULT_PROBE_INTERVAL;
+    int udpTimeout = DEFAULT_PROBE_TIMEOUT;
+    int icmpTimeout = DEFAULT_PROBE_TIMEOUT;
+    int httpTimeout = DEFAULT_PROBE_TIMEOUT;
+} TargetConfig;
+
 typedef struct : public Config
 {
     int chipId = BOARD_DEFAULT_CHIPID;
@@ -90,10 +177,9 @@ typedef struct : public Config
     String hotSpotPwd = DEFAULT_HOTSPOTPWD;
     String wifiName = DEFAULT_WIFISSID;
     String wifiPwd = DEFAULT_WIFIPWD;
-    int lockupTime = DEFAULT_LOCKUP_TIME;
-    int cooldownTime = DEFAULT_COOLDOWN_TIME;
-    int heartBeatCnt = DEFAULT_HEARTBEAT_COUNT;
-    bool enabled = DEFAULT_WD_ENABLED;
+    uint8_t targetCount = DEFAULT_TARGET_COUNT;
+    TargetConfig targets[MAX_TARGETS];
+    uint32_t consoleBaud = DEFAULT_CONSOLE_BAUD; // the board console on UART0
 } BoardConfig;
 
 typedef Config*(*ConfigAccessFunction)(CONFIG_TYPE type);
@@ -0,0 +1,83 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _HAL_H_INCLUDED_
+#define _HAL_H_INCLUDED_
+
+#include <stdint.h>
+
+typedef enum : uint8_t
+{
+  HAL_TIMER_DEADLINE = 0, // lockup deadline of the SanityChecker
+  HAL_TIMER_PULSE,        // step timing of the PulseEngine
+  HAL_MAXTIMERS
+} HAL_TIMER;
+
+// thin hardware abstraction used by the watchdog logic; on the ESP32 it
+// forwards to the Arduino core, the host simulator installs a virtual one
+class Hal
+{
+public:
+  virtual ~Hal () { }
+
+  virtual void pinMode(uint8_t pin, uint8_t mode) = 0;
+  virtual int digitalRead(uint8_t pin) = 0;
+  virtual void digitalWrite(uint8_t pin, uint8_t val) = 0;
+  virtual unsigned long millis() = 0;
+  virtual void delay(unsigned long ms) = 0;
+  virtual void yield() = 0;
+
+  virtual unsigned long micros() = 0;
+  // isr is called with arg, so one handler can serve many pins
+  virtual void attachInterrupt(uint8_t pin, void (*isr)(void*), void* arg, int mode) = 0;
+  // one-shot timers with microsecond resolution, re-arming replaces a pending
+  // expiry; the callback runs in the high priority timer task, so it must be
+  // short and must not block
+  virtual void armTimer(HAL_TIMER timer, uint64_t us, void (*callback)()) = 0;
+
+  // timestamps that are safe to take from an ISR, no virtual dispatch
+  static uint32_t isrMicros();
+  static uint32_t isrMillis();
+
+  // wakes the task that runs the watchdog; safe from ISRs, timer callbacks
+  // and other tasks, does nothing until a task is set
+  static void wakeWatchdog();
+  static void setWatchdogTask(void* task);
+
+  static Hal* instance();
+  static void install(Hal* hal);
+protected:
+  Hal () { }
+private:
+  static Hal* s_hal;
+  static void* s_watchdogTask;
+};
+
+#endif // _HAL_H_INCLUDED_
@@ -0,0 +1,71 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _INTERVALSTATS_H_INCLUDED_
+#define _INTERVALSTATS_H_INCLUDED_
+
+#include <stdint.h>
+
+#define INTERVALSTATS_SUBBUCKETS    4   // per power of two, about +/-12% resolution
+#define INTERVALSTATS_BUCKETS       (INTERVALSTATS_SUBBUCKETS * 31)
+
+// streaming statistics over uint32 samples (intervals in us) in constant
+// memory: min, max, mean and variance (Welford) plus a log-bucketed
+// histogram that percentiles are estimated from
+class IntervalStats
+{
+public:
+  IntervalStats () { reset(); }
+  void reset();
+  void add(uint32_t value);
+  void merge(const IntervalStats& other);
+
+  uint32_t count() const { return m_count; }
+  uint32_t min() const { return m_count ? m_min : 0; }
+  uint32_t max() const { return m_max; }
+  double mean() const { return m_mean; }
+  double variance() const { return m_count > 1 ? m_m2 / (m_count - 1) : 0.0; }
+  uint32_t percentile(double q) const;
+
+  uint32_t bucketCount(int bucket) const { return m_buckets[bucket]; }
+  static uint32_t bucketLower(int bucket);
+  static uint64_t bucketUpper(int bucket);
+private:
+  static int bucketOf(uint32_t value);
+
+  uint32_t                  m_count;
+  uint32_t                  m_min;
+  uint32_t                  m_max;
+  double                    m_mean;
+  double                    m_m2;
+  uint32_t                  m_buckets[INTERVALSTATS_BUCKETS];
+};
+
+#endif // _INTERVALSTATS_H_INCLUDED_
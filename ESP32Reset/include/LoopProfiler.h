@@ -0,0 +1,100 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _LOOPPROFILER_H_INCLUDED_
+#define _LOOPPROFILER_H_INCLUDED_
+
+// build with -DLOOP_PROFILER=1 to time the sections of the task loops
+#ifndef LOOP_PROFILER
+#define LOOP_PROFILER               0
+#endif
+
+#include <stdint.h>
+
+#include "Singleton.h"
+#include "IntervalStats.h"
+
+typedef enum : uint8_t
+{
+  PROF_LANE_WATCHDOG = 0, // watchdog task, core 1
+  PROF_LANE_SERVICE,      // WiFi, web and logging task, core 0
+  MAXPROFLANES
+} PROF_LANE;
+
+// each section belongs to one lane, see s_sectionLanes
+typedef enum : uint8_t
+{
+  PROF_PULSES = 0,  // reset button and PulseEngine::iterate
+  PROF_CHECKER,     // SanityChecker::iterate
+  PROF_BUTTONS,     // flash button handling
+  PROF_LOGGER,      // MemLogger::iterate
+  PROF_STORAGE,     // config flush
+  PROF_IDLE,        // yield and delay
+  MAXPROFSECTIONS
+} PROF_SECTION;
+
+#if LOOP_PROFILER
+#define PROFILE_BEGIN(lane)         LoopProfiler::instance()->begin(lane)
+#define PROFILE_MARK(section)       LoopProfiler::instance()->mark(section)
+#else
+#define PROFILE_BEGIN(lane)
+#define PROFILE_MARK(section)
+#endif
+
+// splits every pass of a task loop into sections with the CPU cycle
+// counter; each mark charges the cycles since the previous mark of the lane
+// to a section, begin() also records the period of the lane. Each lane is
+// only touched by its own task. Stats are in cycles, see cyclesPerMicro()
+class LoopProfiler : public Singleton <LoopProfiler>
+{
+  friend class Singleton <LoopProfiler>;
+public:
+  ~LoopProfiler () { }
+  void begin(PROF_LANE lane);
+  void mark(PROF_SECTION section);
+
+  // consistent copies for readers in other tasks
+  void section(PROF_SECTION section, IntervalStats& out);
+  void period(PROF_LANE lane, IntervalStats& out);
+  void reset();
+  uint32_t cyclesPerMicro() const;
+  static const char* sectionName(PROF_SECTION section);
+  static const char* laneName(PROF_LANE lane);
+protected:
+  LoopProfiler ();
+private:
+  IntervalStats             m_sections[MAXPROFSECTIONS];
+  IntervalStats             m_period[MAXPROFLANES]; // begin() to begin()
+  uint32_t                  m_mark[MAXPROFLANES];   // cycle count of the last mark
+  uint32_t                  m_begin[MAXPROFLANES];
+  bool                      m_started[MAXPROFLANES];
+};
+
+#endif // _LOOPPROFILER_H_INCLUDED_
@@ -31,11 +31,85 @@
 #ifndef _MEMLOGGER_H_INCLUDED_
 #define _MEMLOGGER_H_INCLUDED_
 
-#include <string>
+#include <stddef.h>
+#include <stdint.h>
 
 #include <Singleton.h>
-#include <CircularBuffer.h>
+#include <SpscRing.h>
 
+#ifndef MEMLOGGER_ARENA_SIZE
+#define MEMLOGGER_ARENA_SIZE        16384 // bytes kept in memory, power of two
+#endif
+#define MEMLOGGER_MAX_RECORD        256  // longer messages are truncated
+#define MEMLOGGER_ISR_QUEUE_SIZE    32   // pending ISR messages, power of two
+#define MEMLOGGER_TASK_QUEUE_SIZE   64   // pending watchdog task messages, power of two
+#define MEMLOGGER_EVENT_FLAG        0x8000 // record header marks a binary event
+#define MEMLOGGER_SKIP_BATCH        16   // records skipped per hold of the log lock
+
+// events with a fixed format, stored as id, timestamp and packed arguments
+// and only rendered to text when the log is read; the formats live in
+// MemLogger.cpp in the same order; watchdog events pass the target first
+typedef enum : uint8_t
+{
+  LOGMSG_RESET_BUTTON = 0,
+  LOGMSG_RESET_IGNORED,
+  LOGMSG_FLASH_BUTTON,
+  LOGMSG_FLASH_PRESSED,
+  LOGMSG_WATCHDOG_ARMED,
+  LOGMSG_SC_COOLDOWN,
+  LOGMSG_SC_RESET_COOLDOWN,
+  LOGMSG_SC_POWER_WATCH_ON,
+  LOGMSG_SC_POWER_WATCH_OFF,
+  LOGMSG_SC_LOCKED_UP,
+  LOGMSG_SC_STATUS_ON,
+  LOGMSG_SC_STATUS_OFF,
+  LOGMSG_SC_SEND_COMBI,
+  LOGMSG_SC_LAST_VALUE,
+  LOGMSG_SC_INIT,
+  LOGMSG_SC_ENABLE,
+  LOGMSG_SC_DISABLE,
+  LOGMSG_SC_RESET,
+  LOGMSG_SC_POWER,
+  LOGMSG_SC_IGNORE_POWER,
+  LOGMSG_SC_COMBI_DONE,
+  LOGMSG_SC_QUEUE_FULL,
+  LOGMSG_SC_BAD_TARGET,
+  LOGMSG_CM_CHIPID,
+  LOGMSG_CM_CONFIGVERSION,
+  LOGMSG_CM_RESETWIFI,
+  LOGMSG_CM_SERVERPORT,
+  LOGMSG_CM_TARGETCOUNT,
+  LOGMSG_CM_HEARTBEATPIN,
+  LOGMSG_CM_POWERWATCHPIN,
+  LOGMSG_CM_RESETPIN,
+  LOGMSG_CM_POWERPIN,
+  LOGMSG_CM_LOCKUPTIME,
+  LOGMSG_CM_COOLDOWNTIME,
+  LOGMSG_CM_HEARTBEATCNT,
+  LOGMSG_CM_ENABLED,
+  LOGMSG_CM_PROBES,
+  LOGMSG_CM_QUORUM,
+  LOGMSG_CM_LOADED,
+  LOGMSG_CM_MIGRATED,
+  LOGMSG_CM_SAVED,
+  LOGMSG_SB_STARTED,
+  LOGMSG_PS_RUNNING,
+  LOGMSG_PS_FAILED,
+  MAXLOGMSGS
+} LOG_MSG_ID;
+
+typedef struct
+{
+  uint32_t millis;
+  uint8_t id;
+  int32_t args[2];
+} IsrLogRecord;
+
+// log kept as length-prefixed records in a fixed byte arena; the oldest
+// records are evicted when it is full. Records are either plain text or
+// binary events that take a few bytes each. They are numbered from 1 in the
+// order they were logged, so every reader can keep its own cursor and pull
+// what it has not seen yet without draining the log for anybody else.
 class MemLogger : public Singleton <MemLogger>
 {
    friend class Singleton <MemLogger>;
@@ -43,13 +117,48 @@ class MemLogger : public Singleton <MemLogger>
       ~MemLogger () { }
       bool init();
       void iterate();
-      void logMessage(std::string msg);
+      void logMessage(const char* msg);
+      void logMessage(const char* msg, size_t len);
+      void logEvent(LOG_MSG_ID id, int32_t arg0 = 0, int32_t arg1 = 0);
+
+      // wait-free, for ISRs only; the event is added to the log by
+      // iterate() in the loop task
+      static void logFromIsr(LOG_MSG_ID id, int32_t arg0 = 0, int32_t arg1 = 0);
+      // wait-free, for the watchdog task only, so it never shares a lock
+      // with the web server on the other core
+      static void logDeferred(LOG_MSG_ID id, int32_t arg0 = 0, int32_t arg1 = 0);
 
-      const char* popLog();   
+      // renders the complete records after seq, up to and including until,
+      // into out as one null terminated string and moves seq to the last
+      // record rendered
+      size_t readSince(uint32_t& seq, char* out, size_t size, uint32_t until = UINT32_MAX);
+      uint32_t lastSeq() const { return m_nextSeq - 1; }
+      uint32_t records() const { return m_nextSeq - m_firstSeq; }
+      uint32_t bytesUsed() const { return m_head - m_tail; }
+      uint32_t evicted() const { return m_evicted; }
+      static uint32_t queueDropped() { return s_isrQueue.dropped() + s_taskQueue.dropped(); }
    protected:
-      MemLogger () { }
+      MemLogger () : m_head(0), m_tail(0), m_firstSeq(1), m_nextSeq(1), m_evicted(0), m_queueDropped(0) { }
    private:
-      CircularBuffer<std::string,128> m_optimizedBuffer;
+      // all ISRs are dispatched on the core they were attached from, one
+      // at a time, so they form a single producer
+      static SpscRing<IsrLogRecord, MEMLOGGER_ISR_QUEUE_SIZE> s_isrQueue;
+      static SpscRing<IsrLogRecord, MEMLOGGER_TASK_QUEUE_SIZE> s_taskQueue;
+
+      void appendEvent(uint32_t millis, uint8_t id, const int32_t* args);
+      void append(uint16_t header, const void* payload, size_t len);
+      size_t renderEvent(const uint8_t* payload, size_t len, char* out, size_t size) const;
+      void copyIn(uint32_t pos, const void* src, size_t len);
+      void copyOut(void* dst, uint32_t pos, size_t len) const;
+      uint16_t recordHeader(uint32_t pos) const;
+
+      uint8_t                   m_arena[MEMLOGGER_ARENA_SIZE];
+      uint32_t                  m_head; // absolute byte offsets, wrap freely
+      uint32_t                  m_tail;
+      uint32_t                  m_firstSeq; // sequence number of the record at m_tail
+      uint32_t                  m_nextSeq;
+      uint32_t                  m_evicted;
+      uint32_t                  m_queueDropped; // queue drops already reported
 };
 
 #endif
@@ -0,0 +1,133 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _METRICS_H_INCLUDED_
+#define _METRICS_H_INCLUDED_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+#include "Singleton.h"
+#include "Constants.h"
+
+#define METRICS_LINE_SIZE           128 // longest rendered line incl. newline
+
+typedef enum : uint8_t
+{
+  METRIC_HEARTBEAT_EDGES = 0,
+  METRIC_LOCKUPS,
+  METRIC_RESET_PULSES,
+  METRIC_POWER_PULSES,
+  METRIC_COOLDOWNS,
+  METRIC_CONFIG_SAVES,
+  METRIC_CONFIG_JSON_BUILDS,
+  METRIC_CONSOLE_BYTES,
+  METRIC_CONSOLE_FIFO_OVERRUNS,
+  METRIC_CONSOLE_RING_OVERRUNS,
+  METRIC_CONSOLE_FRAME_ERRORS,
+  METRIC_CONSOLE_TX_BYTES,
+  METRIC_CONSOLE_INPUT_DROPPED,
+  METRIC_PROBE_SUCCESSES,
+  METRIC_PROBE_FAILURES,
+  METRIC_UDP_HEARTBEATS_LOST,
+  MAXMETRICS
+} METRIC_ID;
+
+typedef enum : uint8_t
+{
+  ROUTE_INDEX = 0,
+  ROUTE_ASSET,
+  ROUTE_SAVECONFIG,
+  ROUTE_WDSTATE,
+  ROUTE_RESET,
+  ROUTE_RESETESP,
+  ROUTE_SHUTDOWN,
+  ROUTE_GETCONFIG,
+  ROUTE_FWVERSION,
+  ROUTE_HBSTATS,
+  ROUTE_POWERSTATUS,
+  ROUTE_LOG,
+  ROUTE_LOGSTREAM,
+  ROUTE_METRICS,
+  ROUTE_PROFILE,
+  ROUTE_TARGETS,
+  ROUTE_STATUS,
+  MAXROUTES
+} HTTP_ROUTE;
+
+typedef enum : uint8_t
+{
+  GAUGE_UPTIME = 0,
+  GAUGE_FREE_HEAP,
+  GAUGE_MIN_FREE_HEAP,
+  GAUGE_WIFI_RSSI,
+  GAUGE_CONFIG_LOAD,
+  GAUGE_WATCHDOG_ARMED,
+  MAXGAUGES
+} GAUGE_ID;
+
+// values of one scrape, rendered line by line so a response can stream it
+// straight into the send buffer
+typedef struct
+{
+  uint32_t counters[MAXMETRICS];
+  uint32_t requests[MAXROUTES];
+  uint32_t logDropped[2]; // evicted, lost in the ISR or watchdog queue
+  int32_t gauges[MAXGAUGES];
+  uint8_t targetCount;
+  uint8_t targetStates[MAX_TARGETS]; // WD_STATE per target
+} MetricsSnapshot;
+
+// counters for the Prometheus /metrics endpoint; safe to bump from the
+// loop and the web server task
+class Metrics : public Singleton <Metrics>
+{
+  friend class Singleton <Metrics>;
+public:
+  ~Metrics () { }
+  void count(METRIC_ID id) { m_counters[id].fetch_add(1, std::memory_order_relaxed); }
+  void add(METRIC_ID id, uint32_t n) { m_counters[id].fetch_add(n, std::memory_order_relaxed); }
+  void countRequest(HTTP_ROUTE route) { m_requests[route].fetch_add(1, std::memory_order_relaxed); }
+
+  // fills everything except the gauges and target states, those are up to
+  // the platform
+  void snapshot(MetricsSnapshot& snap) const;
+  // renders line number line of the text exposition format into out,
+  // returns 0 past the last line
+  static size_t renderLine(const MetricsSnapshot& snap, uint16_t line, char* out, size_t size);
+protected:
+  Metrics ();
+private:
+  std::atomic<uint32_t>     m_counters[MAXMETRICS];
+  std::atomic<uint32_t>     m_requests[MAXROUTES];
+};
+
+#endif // _METRICS_H_INCLUDED_
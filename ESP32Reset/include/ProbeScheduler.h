@@ -0,0 +1,112 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _PROBESCHEDULER_H_INCLUDED_
+#define _PROBESCHEDULER_H_INCLUDED_
+
+#include <Arduino.h>
+
+#include "Singleton.h"
+#include "Constants.h"
+#include "ConfigRecord.h"
+
+#define PROBE_UDP_REORDER           64   // older sequence numbers are late, not a restarted sender
+#define PROBE_HTTP_STATUS_SIZE      16   // "HTTP/1.1 200" is all that is read of the answer
+#define PROBE_TASK_WAIT             1000 // ms, longest wait of the probe task in select
+
+// called from the probe task for every probe that found its target alive
+typedef void (*ProbeCallback)(uint8_t target, uint8_t probe);
+
+// runs the network probes of all targets from one task: the UDP heartbeat
+// listeners, ICMP echo and HTTP health checks share a single select loop on
+// non-blocking sockets, so a slow or dead target delays nothing else. The
+// probes only report success; whether a target is alive is decided by the
+// SanityChecker, which times each probe out and applies the quorum. The
+// GPIO heartbeat stays with the pin interrupts and never waits for this
+class ProbeScheduler : public Singleton <ProbeScheduler>
+{
+  friend class Singleton <ProbeScheduler>;
+public:
+  ~ProbeScheduler () { stop(); }
+  // the probes of a target that can run with its settings; ICMP and HTTP
+  // need an address, a target without any falls back to the heartbeat pin
+  static uint8_t usable(const TargetConfig& cfg);
+
+  void begin(ProbeCallback callback);
+  // opens the sockets the target needs, returns the probes that are running
+  uint8_t configure(uint8_t target, const TargetConfig& cfg);
+  // does what is due at now and waits at most waitMs for an answer
+  void iterate(unsigned long now, unsigned long waitMs);
+  void stop();
+  uint8_t running(uint8_t target) const { return m_targets[target].probes; }
+
+  // FreeRTOS task running iterate, started once at boot after WiFi
+  static void task(void* arg);
+protected:
+  ProbeScheduler ();
+private:
+  typedef struct
+  {
+    uint8_t probes; // running network probes, PROBE_BIT
+    uint32_t address; // network order
+    uint16_t httpPort;
+    char httpPath[CONFIG_PATH_SIZE];
+    unsigned long interval;
+
+    int udpSocket;
+    bool haveSeq;
+    uint32_t udpSeq;
+
+    uint16_t icmpSeq;
+    bool icmpPending; // request sent, no reply yet
+    unsigned long icmpNext;
+
+    int httpSocket;
+    bool httpSent;
+    size_t httpLen;
+    char httpStatus[PROBE_HTTP_STATUS_SIZE];
+    unsigned long httpStart;
+    unsigned long httpNext;
+  } ProbeTarget;
+
+  void receiveUdp(uint8_t target);
+  void receiveIcmp();
+  void sendIcmp(uint8_t target, unsigned long now);
+  void startHttp(uint8_t target, unsigned long now);
+  void serviceHttp(uint8_t target, bool writable, bool readable);
+  void endHttp(uint8_t target, bool ok);
+  void closeTarget(uint8_t target);
+
+  ProbeCallback             m_callback;
+  int                       m_icmpSocket; // shared, replies are told apart by id
+  ProbeTarget               m_targets[MAX_TARGETS];
+};
+
+#endif
@@ -0,0 +1,87 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _PULSEENGINE_H_INCLUDED_
+#define _PULSEENGINE_H_INCLUDED_
+
+#include <atomic>
+
+#include "Singleton.h"
+
+#define PULSE_MAX_STEPS             64 // queued steps, power of two
+#define PULSE_MAX_WAVEFORMS         16 // queued completion callbacks, power of two
+
+typedef void (*PulseCallback)(void* arg);
+
+// drive pin to level and hold it for holdUs before the next step starts
+typedef struct
+{
+  uint8_t pin;
+  uint8_t level;
+  bool last;      // set by the engine on the final step of a waveform
+  uint32_t holdUs;
+} PulseStep;
+
+// plays queued waveforms (pulse, gap, pulse, ...) on the output pins from a
+// one-shot timer, so callers never block while a pulse is held; completion
+// callbacks run from iterate() in the loop task
+class PulseEngine : public Singleton <PulseEngine>
+{
+  friend class Singleton <PulseEngine>;
+public:
+  ~PulseEngine () { }
+  bool queue(const PulseStep* steps, uint8_t count, PulseCallback done = NULL, void* arg = NULL);
+  bool busy() const { return m_running.load() != 0; }
+  void iterate();
+protected:
+  PulseEngine () : m_head(0), m_tail(0), m_running(0), m_queued(0), m_completed(0), m_notified(0) { }
+private:
+  static void onTimer();
+  void kick();
+  void startStep();
+
+  typedef struct
+  {
+    PulseCallback callback;
+    void* arg;
+  } Waveform;
+
+  PulseStep                 m_steps[PULSE_MAX_STEPS];
+  std::atomic<uint16_t>     m_head;      // written by the loop task
+  std::atomic<uint16_t>     m_tail;      // written by whoever plays the steps
+  std::atomic<uint32_t>     m_running;   // owner flag of the step timer
+
+  Waveform                  m_waveforms[PULSE_MAX_WAVEFORMS];
+  uint32_t                  m_queued;
+  std::atomic<uint32_t>     m_completed;
+  uint32_t                  m_notified;
+};
+
+#endif // _PULSEENGINE_H_INCLUDED_
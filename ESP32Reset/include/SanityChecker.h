@@ -31,44 +31,172 @@
 #ifndef _SANITYCHECKER_H_INCLUDED_
 #define _SANITYCHECKER_H_INCLUDED_
 
+#include <Arduino.h>
+
 #include "Singleton.h"
+#include "Constants.h"
+#include "SpscRing.h"
+#include "IntervalStats.h"
+
+#define SC_EDGE_RING_SIZE           64 // pending pin edges, power of two
+#define SC_COMMAND_RING_SIZE        8  // pending web commands, power of two
+#define SC_PROBE_RING_SIZE          32 // pending probe results, power of two
+#define SC_MAX_PINS                 40 // GPIOs of the ESP32
+#define SC_NO_TARGET                0xFF
 
+typedef enum : uint8_t
+{
+  WD_DISABLED = 0,
+  WD_COOLDOWN,
+  WD_WATCHING,
+  WD_RECOVERING,
+  MAXWDSTATES
+} WD_STATE;
+
+typedef enum : uint8_t
+{
+  WD_CMD_ENABLE = 0,
+  WD_CMD_DISABLE,
+  WD_CMD_RESET, // arg is the pulse length in ms
+  WD_CMD_POWER,
+  MAXWDCMDS
+} WD_CMD;
+
+typedef struct
+{
+  uint32_t micros;
+  uint8_t pin;
+} PinEdge;
+
+typedef struct
+{
+  uint8_t cmd;
+  uint8_t target;
+  uint32_t arg;
+} WatchdogCommand;
+
+typedef struct
+{
+  uint8_t target;
+  uint8_t probe; // PROBE_TYPE, MAXPROBES reports the probes that started
+  uint8_t started; // PROBE_BIT of the running network probes, for MAXPROBES
+} ProbeResult;
+
+// supervises up to MAX_TARGETS boards; the per-target settings and state
+// are kept as arrays indexed by target and all targets are evaluated in
+// one pass whenever an edge or a probe result arrives or the earliest
+// deadline expires. A target is alive while at least its quorum of probes
+// is up; a probe is up until its timeout has passed since its last success,
+// for the heartbeat pin the timeout is lockupTime
 class SanityChecker : public Singleton <SanityChecker>
 {
    friend class Singleton <SanityChecker>;
    public:
       ~SanityChecker () { }
-      bool init(unsigned long nowTime, uint32_t interval = 1000); // in ms...
-      void setState(bool enabled);
+      // init, iterate and send* belong to the watchdog task; other tasks
+      // only post commands and read the status getters
+      bool init(unsigned long nowTime);
       void iterate(unsigned long currentTime);
-      void sendPower(unsigned long timePullDown, bool ignorePowerStatus = true);
-      void sendReset(unsigned long timePullDown);
-      int lastHeatBeatVal() const { return m_lastHeartBeatValue; }
-      int currentPowerStatus() const { return m_lastPowerValue; }
+      bool sendPower(uint8_t target, unsigned long timePullDown, bool ignorePowerStatus = true);
+      bool sendReset(uint8_t target, unsigned long timePullDown);
+
+      // wait-free, for the web server task only
+      bool post(WD_CMD cmd, uint8_t target, uint32_t arg = 0);
+      void setState(uint8_t target, bool enabled) { post(enabled ? WD_CMD_ENABLE : WD_CMD_DISABLE, target); }
+      // wait-free, for the probe task only
+      static void probeOk(uint8_t target, uint8_t probe);
+      // wait-free, from setup after the probe scheduler is configured and
+      // before its task starts; a probe that did not start no longer counts
+      static void probesStarted(uint8_t target, uint8_t probes);
+
+      uint8_t targetCount() const { return m_targetCount; }
+      bool supervised(uint8_t target) const { return m_supervised & (1 << target); }
+      bool recovering(uint8_t target) const { return m_recovering & (1 << target); }
+      WD_STATE state(uint8_t target, unsigned long currentTime) const;
+      int lastHeatBeatVal(uint8_t target) const { return m_lastHeartBeatValue[target]; }
+      int currentPowerStatus(uint8_t target) const { return m_lastPowerValue[target]; }
+      unsigned long lockupTime(uint8_t target) const { return m_lockupTimeTrigger[target]; }
+      uint8_t probes(uint8_t target) const { return m_probes[target]; }
+      uint8_t quorum(uint8_t target) const { return m_quorum[target]; }
+      uint8_t probesUp(uint8_t target, unsigned long currentTime) const;
+      bool enabled(uint8_t target) const { return m_enabled & (1 << target); }
+      unsigned long sinceLastEdge(uint8_t target, unsigned long currentTime) const { return currentTime - m_lastTimeHeartBeatChanged[target]; }
+      unsigned long coolDownRemaining(uint8_t target, unsigned long currentTime) const
+      {
+        return currentTime < m_coolDownEnd[target] ? m_coolDownEnd[target] - currentTime : 0;
+      }
+      uint32_t lockups(uint8_t target) const { return m_lockups[target]; } // since boot
+      unsigned long nextDeadline() const { return m_nextDeadline; }
+      unsigned long armedMicros() const { return m_armedMicros; } // end of init since boot
+      uint32_t droppedEdges() const { return s_edges.dropped(); }
+      // updated by the watchdog task, copied under a lock for other tasks
+      void heartBeatStats(uint8_t target, IntervalStats& out) const;
+      // time from a pin edge to its evaluation by the watchdog task in us
+      void edgeLatencyStats(IntervalStats& out) const;
+      void resetHeartBeatStats() { m_resetStats = true; }
    protected:
-      SanityChecker () { }
+      SanityChecker () : m_armedMicros(0), m_targetCount(0) { }
    private:
-      void convertMillis(unsigned long milli, unsigned long& hour, unsigned long &minute, unsigned long &second, unsigned long &remainder);
-      bool coolDownActive(unsigned long currentTime, unsigned long hour, unsigned long minute, unsigned long second, unsigned long remainder);
-      bool readHeartBeat(unsigned long currentTime, unsigned long hour, unsigned long minute, unsigned long second, unsigned long remainder);
+      static void onPinEdge(void* arg);
+      static void onDeadline();
+      static void onRecoveryDone(void* arg);
+
+      bool validPins(uint8_t target) const;
+      bool coolDownActive(uint8_t target, unsigned long currentTime);
+      void consumeCommands();
+      void consumeEdges(unsigned long currentTime);
+      void consumeProbes(unsigned long currentTime);
+      void setProbes(uint8_t target, uint8_t probes);
+      unsigned long probeExpiry(uint8_t target, uint8_t probe) const;
+      void samplePins();
+      bool lockedUp(uint8_t target, unsigned long currentTime);
+      void recover(uint8_t target, unsigned long currentTime);
+      void armDeadline(unsigned long currentTime);
+
+      static SpscRing<PinEdge, SC_EDGE_RING_SIZE> s_edges; // filled from the pin ISRs
+      static volatile bool     s_deadlineExpired;
+      static SpscRing<WatchdogCommand, SC_COMMAND_RING_SIZE> s_commands; // filled by the web server
+      static SpscRing<ProbeResult, SC_PROBE_RING_SIZE> s_probeResults; // filled by the probe task
+
+      unsigned long            m_nextDeadline; // earliest time a lockup condition must be checked
+      unsigned long            m_lastTimeLoopIteration; // general
+      unsigned long            m_armedMicros;
 
-      uint32_t                 m_pollingInterval;
-      unsigned long            m_nextPoll;
+      uint8_t                  m_pinTarget[SC_MAX_PINS]; // input pin to target, SC_NO_TARGET if unused
 
-      bool                      m_enabled;
+      // one bit per target
+      uint8_t                  m_supervised; // pin mapping is valid
+      uint8_t                  m_enabled;
+      uint8_t                  m_recovering; // power/reset combi is being sent
+      uint8_t                  m_haveLastEdge; // cleared until the first edge after boot or recovery
 
-      unsigned long             m_coolDownEnd; // time when cooldown started
-      bool                      m_resetApplied; // reset was last action taken
-      unsigned long             m_lastTimeHeartBeatChanged; // last time value changed
-      unsigned long             m_lastTimeLoopIteration; // general
-      int                       m_lastHeartBeatValue; // default to off
-      int                       m_lastPowerValue;
-      int                       m_heartBeatCounter;
+      // one entry per target
+      uint8_t                  m_targetCount;
+      uint8_t                  m_heartBeatPin[MAX_TARGETS];
+      uint8_t                  m_powerWatchPin[MAX_TARGETS];
+      uint8_t                  m_resetPin[MAX_TARGETS];
+      uint8_t                  m_powerPin[MAX_TARGETS];
+      unsigned long            m_lockupTimeTrigger[MAX_TARGETS];
+      unsigned long            m_coolDownTimeTrigger[MAX_TARGETS];
+      int                      m_heartBeatCountTrigger[MAX_TARGETS];
+      uint8_t                  m_probes[MAX_TARGETS]; // PROBE_BIT of the probes that count
+      uint8_t                  m_quorum[MAX_TARGETS]; // probes that have to be up
+      uint8_t                  m_quorumSetting[MAX_TARGETS]; // as configured, 0 for all
+      uint8_t                  m_probesSeen[MAX_TARGETS]; // succeeded since boot or recovery
+      unsigned long            m_probeTimeout[MAX_TARGETS][MAXPROBES];
+      unsigned long            m_lastProbeOk[MAX_TARGETS][MAXPROBES]; // not used for the heartbeat pin
 
-      int                       m_heartBeatCountTrigger;
-      unsigned long             m_coolDownTimeTrigger;
-      unsigned long             m_lockupTimeTrigger;
+      unsigned long            m_coolDownEnd[MAX_TARGETS]; // time when cooldown ends
+      unsigned long            m_lastTimeHeartBeatChanged[MAX_TARGETS]; // last time value changed
+      int                      m_heartBeatCounter[MAX_TARGETS];
+      uint8_t                  m_lastHeartBeatValue[MAX_TARGETS]; // default to off
+      uint8_t                  m_lastPowerValue[MAX_TARGETS];
+      uint32_t                 m_lastEdgeMicros[MAX_TARGETS];
+      uint32_t                 m_lockups[MAX_TARGETS];
+      IntervalStats            m_heartBeatStats[MAX_TARGETS]; // time between heartbeat edges in us
 
+      IntervalStats            m_edgeLatency;
+      volatile bool            m_resetStats;
 };
 
 #endif
@@ -0,0 +1,97 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _SERIALBRIDGE_H_INCLUDED_
+#define _SERIALBRIDGE_H_INCLUDED_
+
+#include <Arduino.h>
+
+#include "Singleton.h"
+#include "SpscRing.h"
+#include "Constants.h"
+
+// a WebSocket fragment of browser input, its bytes are in the transmit ring
+typedef struct
+{
+  uint32_t                  client;
+  uint32_t                  len;
+  bool                      last;     // ends the message, followed by CR LF
+  bool                      dropped;  // did not fit, only acknowledged
+} ConsoleInput;
+
+// input of one client dropped because the fragment ring was full
+typedef struct
+{
+  uint32_t                  client;
+  uint32_t                  len;
+  bool                      pending;  // not acknowledged yet
+} ConsoleOverflow;
+
+// owns UART0, which is wired to the console of the board. The UART driver
+// moves received bytes into a large ring from its interrupt, a task of its
+// own waits for the driver events and hands the data to WebSerialPro, so
+// neither a slow loop nor a boot flood loses console output. Browser input
+// goes the other way through a transmit ring that the same task feeds into
+// the UART FIFO as it empties; each client gets acknowledgements to pace
+// itself by
+class SerialBridge : public Singleton <SerialBridge>
+{
+  friend class Singleton <SerialBridge>;
+public:
+  ~SerialBridge () { }
+  // installs the driver and starts the task, once at boot
+  bool begin(uint32_t baud);
+  bool setBaud(uint32_t baud);
+  uint32_t baud() const { return m_baud; }
+  // to the console; called by the web server task, never waits
+  bool queueInput(uint32_t client, const uint8_t* data, size_t len, bool last);
+protected:
+  SerialBridge () : m_events(NULL), m_baud(0), m_txLeft(0), m_txEol(0), m_txActive(false) { }
+private:
+  static void eventTask(void* arg);
+  void drain();
+  bool feed();
+  bool overflow(uint32_t client, size_t len);
+  void ackOverflows();
+
+  static SpscByteRing<SERIAL_BRIDGE_TX_BUFFER> s_txData;
+  static SpscRing<ConsoleInput, SERIAL_BRIDGE_TX_INPUTS> s_txInputs;
+  static ConsoleOverflow s_txOverflows[SERIAL_BRIDGE_TX_OVERFLOWS];
+  static portMUX_TYPE s_txOverflowMux;
+
+  QueueHandle_t             m_events;
+  uint32_t                  m_baud;
+  ConsoleInput              m_txInput;  // being sent
+  uint32_t                  m_txLeft;
+  uint8_t                   m_txEol;
+  bool                      m_txActive;
+};
+
+#endif // _SERIALBRIDGE_H_INCLUDED_
@@ -0,0 +1,121 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _SPSCRING_H_INCLUDED_
+#define _SPSCRING_H_INCLUDED_
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+// wait-free single-producer/single-consumer ring of fixed size; the producer
+// may run in an ISR, the consumer in a task. SIZE must be a power of two.
+template <typename T, uint16_t SIZE> class SpscRing
+{
+  static_assert(SIZE > 1 && (SIZE & (SIZE - 1)) == 0, "SpscRing size must be a power of two");
+public:
+  SpscRing () : m_head(0), m_tail(0), m_dropped(0) { }
+
+  // producer side, returns false and counts the item if the ring is full
+  bool push(const T& item)
+  {
+    uint16_t head = m_head.load(std::memory_order_relaxed);
+    if((uint16_t)(head - m_tail.load(std::memory_order_acquire)) == SIZE)
+    {
+      m_dropped = m_dropped + 1;
+      return false;
+    }
+    m_items[head & (SIZE - 1)] = item;
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // consumer side
+  bool pop(T& item)
+  {
+    uint16_t tail = m_tail.load(std::memory_order_relaxed);
+    if(tail == m_head.load(std::memory_order_acquire))
+      return false;
+    item = m_items[tail & (SIZE - 1)];
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const { return m_tail.load(std::memory_order_relaxed) == m_head.load(std::memory_order_acquire); }
+  uint16_t size() const { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_relaxed); }
+  uint32_t dropped() const { return m_dropped; }
+private:
+  T                         m_items[SIZE];
+  std::atomic<uint16_t>     m_head;
+  std::atomic<uint16_t>     m_tail;
+  volatile uint32_t         m_dropped;
+};
+
+// the same for a stream of bytes; the consumer reads them in place, so
+// they are copied once, by the producer
+template <uint16_t SIZE> class SpscByteRing
+{
+  static_assert(SIZE > 1 && (SIZE & (SIZE - 1)) == 0, "SpscByteRing size must be a power of two");
+public:
+  SpscByteRing () : m_head(0), m_tail(0) { }
+
+  // producer side, all or nothing
+  bool write(const uint8_t* data, size_t len)
+  {
+    uint16_t head = m_head.load(std::memory_order_relaxed);
+    if(len > (size_t)(SIZE - (uint16_t)(head - m_tail.load(std::memory_order_acquire))))
+      return false;
+    uint16_t pos = head & (SIZE - 1);
+    size_t first = len < (size_t)(SIZE - pos) ? len : SIZE - pos;
+    memcpy(m_data + pos, data, first);
+    memcpy(m_data, data + first, len - first);
+    m_head.store(head + len, std::memory_order_release);
+    return true;
+  }
+
+  // consumer side, the bytes that can be read in one piece
+  uint16_t peek(const uint8_t*& data) const
+  {
+    uint16_t tail = m_tail.load(std::memory_order_relaxed);
+    uint16_t avail = m_head.load(std::memory_order_acquire) - tail;
+    uint16_t pos = tail & (SIZE - 1);
+    data = m_data + pos;
+    return avail < SIZE - pos ? avail : SIZE - pos;
+  }
+
+  void consume(uint16_t len) { m_tail.store(m_tail.load(std::memory_order_relaxed) + len, std::memory_order_release); }
+  uint16_t size() const { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_relaxed); }
+private:
+  uint8_t                   m_data[SIZE];
+  std::atomic<uint16_t>     m_head;
+  std::atomic<uint16_t>     m_tail;
+};
+
+#endif // _SPSCRING_H_INCLUDED_
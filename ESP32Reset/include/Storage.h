@@ -0,0 +1,82 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _STORAGE_H_INCLUDED_
+#define _STORAGE_H_INCLUDED_
+
+#include <Arduino.h>
+#include <FS.h>
+#include <memory>
+
+#include "Singleton.h"
+
+#define STORAGE_MAX_CACHED          8  // static files kept open for serving
+#define STORAGE_PATH_SIZE           32
+
+typedef struct
+{
+  char path[STORAGE_PATH_SIZE];
+  File file;
+  size_t size;
+} CachedFile;
+
+// owns LittleFS: mounted once at boot and never unmounted. Every access
+// from any task goes through here and is serialized by one lock. Hot
+// static files are opened once and read at an offset, so concurrent
+// responses share a handle without paying for an open per request
+class Storage : public Singleton <Storage>
+{
+  friend class Singleton <Storage>;
+public:
+  ~Storage () { }
+  bool mount();
+  bool mounted() const { return m_mounted; }
+
+  // blocking, any task
+  bool readFile(const char* path, std::unique_ptr<char[]>& buf, size_t& size); // zero terminated
+  bool remove(const char* path);
+
+  // handle of a file kept open, -1 if it does not exist
+  int openCached(const char* path, size_t& size);
+  size_t readCached(int handle, size_t offset, uint8_t* buf, size_t len);
+protected:
+  Storage ();
+private:
+  void lock() { xSemaphoreTakeRecursive(m_lock, portMAX_DELAY); }
+  void unlock() { xSemaphoreGiveRecursive(m_lock); }
+  void dropCached(const char* path);
+
+  SemaphoreHandle_t         m_lock;
+  volatile bool             m_mounted;
+  CachedFile                m_cached[STORAGE_MAX_CACHED];
+  int                       m_cachedCount;
+};
+
+#endif // _STORAGE_H_INCLUDED_
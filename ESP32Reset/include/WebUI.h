@@ -0,0 +1,275 @@
+// Generated by WebUIBuilder.py from data/index.html, do not edit
+
+#ifndef _WEBUI_H_INCLUDED_
+#define _WEBUI_H_INCLUDED_
+
+#define WEBUI_ETAG "\"1c187c6862bd8117\""
+
+const uint32_t WEBUI_HTML_SIZE = 7862;
+const uint8_t WEBUI_HTML[] PROGMEM = {
+31,139,8,0,0,0,0,0,2,3,237,61,107,119,218,72,178,223,253,43,58,204,217,27,123,130,132,16,96,99,
+176,189,87,248,17,59,99,199,241,35,201,204,100,114,230,8,169,1,197,66,98,36,97,236,120,184,191,253,86,117,
+183,208,3,73,8,39,179,59,231,236,154,196,70,221,93,143,174,170,174,170,126,72,218,123,113,116,121,120,251,203,
+187,99,114,122,123,113,126,176,55,10,198,246,193,222,11,73,34,135,54,29,83,199,39,154,23,140,170,68,187,110,
+146,215,227,254,41,81,21,181,94,37,125,221,167,38,113,29,162,59,132,62,232,227,137,77,73,255,145,92,79,45,
+114,163,59,129,235,19,64,224,98,113,64,201,196,115,191,80,35,32,38,13,116,203,246,137,30,144,81,16,76,252,
+78,173,118,173,59,166,59,126,75,61,243,118,26,184,158,165,219,190,108,184,99,242,142,122,99,203,247,45,160,96,
+249,100,68,61,10,216,135,30,160,166,102,149,12,60,74,137,59,32,198,72,247,134,180,74,2,23,248,120,36,19,
+234,249,0,224,246,129,140,99,57,67,162,19,195,157,60,98,203,96,4,104,124,119,16,204,116,143,66,99,147,232,
+190,239,26,150,14,248,136,233,26,83,232,106,160,7,72,111,96,217,212,151,201,237,8,218,245,221,123,202,112,120,
+214,112,20,16,199,13,44,131,131,51,132,147,136,75,81,229,143,116,219,38,125,74,44,199,176,167,38,32,183,64,
+70,80,4,72,44,234,19,215,35,254,180,239,7,208,17,232,43,153,184,30,210,244,57,139,148,220,8,14,101,34,
+73,160,11,170,155,7,123,99,144,26,113,244,49,221,175,220,91,116,134,32,21,64,7,146,112,130,253,202,204,50,
+131,209,190,73,239,129,186,196,46,170,64,210,66,236,146,111,232,54,221,175,87,14,200,158,31,60,218,244,96,99,
+164,146,167,141,1,192,74,3,125,108,217,143,29,208,46,180,236,242,50,223,250,74,59,68,149,91,30,29,119,55,
+2,250,16,72,186,109,13,157,14,49,128,22,245,186,27,243,13,121,96,211,7,9,201,131,140,169,7,232,76,203,
+159,216,58,160,194,26,222,196,178,109,206,11,82,131,210,14,169,99,197,94,141,179,17,178,35,143,65,252,72,95,
+178,12,20,130,127,63,124,98,96,157,58,48,48,162,40,115,246,21,17,118,140,169,231,1,27,135,174,237,122,221,
+123,10,130,131,238,9,6,199,150,105,218,116,30,18,16,248,107,63,190,216,32,63,146,11,65,5,122,71,238,235,
+178,34,43,100,19,237,15,204,111,28,85,25,62,179,188,45,132,56,92,104,92,85,234,77,9,126,237,196,177,48,
+164,103,183,228,28,100,238,248,148,99,67,107,246,244,153,60,180,130,209,180,63,245,169,39,116,132,88,107,71,238,
+112,160,219,110,156,32,124,247,225,162,118,126,118,120,252,246,230,24,9,215,100,143,154,79,125,221,184,27,122,238,
+212,49,65,206,208,217,206,15,39,205,102,163,177,77,94,88,99,212,62,216,206,28,27,202,186,129,122,145,154,25,
+16,71,45,5,126,226,16,56,176,159,108,208,153,20,10,86,174,183,186,210,216,151,152,162,81,247,146,110,126,153,
+250,80,163,40,255,232,74,51,218,191,179,130,236,218,121,223,53,31,159,198,48,250,44,167,163,204,251,211,32,112,
+157,170,229,76,166,65,213,167,54,12,246,42,194,129,37,235,79,113,115,243,117,199,151,64,52,214,160,27,89,28,
+35,183,196,89,38,242,39,24,143,222,192,118,103,157,123,203,183,250,160,114,81,203,137,62,49,102,3,112,19,254,
+192,245,198,29,199,117,22,45,176,255,228,83,240,56,129,113,196,139,42,159,171,226,218,163,62,13,162,75,24,161,
+99,11,174,159,66,25,232,147,9,213,1,171,65,59,28,84,32,237,116,164,177,251,85,26,128,255,240,37,203,129,
+241,80,77,81,200,111,33,104,230,55,8,185,88,110,241,212,119,61,147,122,18,179,114,214,201,238,68,55,77,240,
+120,11,113,197,96,60,40,95,98,43,187,58,228,41,187,118,193,80,178,250,201,157,6,168,189,78,125,242,0,174,
+52,64,143,218,99,116,110,65,27,243,133,29,44,84,167,131,167,159,11,156,198,136,26,119,125,247,33,166,11,221,
+180,220,152,236,161,18,205,4,59,39,186,13,37,221,236,210,72,10,2,153,51,29,247,169,199,100,40,208,49,1,
+74,254,196,114,36,97,24,185,77,161,95,201,166,79,194,62,227,29,240,193,48,140,81,182,173,96,215,7,22,181,
+205,174,16,145,228,14,6,32,225,142,164,78,30,210,8,34,186,188,68,50,16,135,157,226,50,183,181,73,13,215,
+99,1,44,139,19,54,16,34,24,12,113,210,116,98,187,186,25,118,45,215,212,217,64,237,88,14,196,96,43,152,
+127,26,129,167,165,206,231,167,208,235,51,204,204,183,60,67,97,243,31,171,63,118,250,20,198,42,133,47,250,0,
+228,157,133,70,16,239,46,23,149,247,60,216,49,232,180,255,8,62,119,92,237,129,54,238,46,116,227,134,93,158,
+64,187,106,229,134,14,93,74,222,159,85,170,215,110,223,13,220,234,229,195,227,144,58,18,228,51,126,245,125,127,
+234,4,211,234,33,120,82,64,109,219,213,202,41,181,239,41,198,32,242,150,78,105,165,26,185,182,185,220,15,28,
+201,31,67,216,79,246,102,164,155,96,254,10,1,237,179,255,10,241,134,125,125,83,169,178,143,92,111,110,85,21,
+210,128,10,28,73,104,35,169,122,21,235,177,174,181,12,172,110,117,255,5,52,98,93,235,140,112,64,103,119,16,
+241,55,242,136,35,242,157,140,74,53,193,89,61,205,89,186,131,127,13,141,185,149,136,145,161,153,89,50,75,7,
+158,192,127,233,65,135,125,23,1,74,178,233,0,34,22,72,107,46,243,44,137,167,36,79,177,244,137,151,207,151,
+113,196,227,51,51,97,62,202,97,248,13,105,228,81,48,151,144,184,109,115,103,207,252,111,70,169,191,92,152,46,
+152,167,114,46,206,38,228,85,48,34,113,92,185,147,192,26,67,80,62,167,67,171,111,217,86,240,184,72,4,248,
+104,162,122,48,245,96,28,209,32,128,246,126,231,37,244,80,127,217,21,33,161,160,69,81,37,136,206,181,137,236,
+185,179,167,184,84,37,121,135,165,162,162,140,137,44,44,156,47,181,70,175,156,108,26,47,129,17,29,184,227,142,
+170,160,162,60,140,66,204,219,136,28,173,83,169,116,67,143,22,232,144,87,116,13,27,220,32,184,170,96,196,154,
+19,228,80,168,14,169,117,191,41,60,145,176,99,192,88,152,243,8,190,24,161,79,134,13,211,147,31,247,43,147,
+169,63,146,32,54,102,213,64,142,13,97,103,226,250,22,122,253,14,120,37,112,255,247,52,194,34,251,13,145,78,
+171,173,127,116,151,68,21,125,139,164,21,7,222,22,192,45,165,44,112,70,138,217,234,254,155,156,48,167,59,227,
+124,56,144,12,194,44,135,231,198,137,17,223,222,217,154,255,239,152,154,150,14,147,89,251,145,248,6,76,45,29,
+54,195,219,68,237,112,17,16,101,235,137,117,46,150,180,54,65,97,101,64,119,119,193,201,102,128,203,173,146,8,
+234,170,162,100,97,96,240,35,245,41,222,209,166,162,164,50,233,198,162,9,131,106,200,173,109,180,188,68,163,250,
+66,195,29,85,110,236,52,196,15,180,3,7,90,151,155,106,147,125,141,199,53,110,213,220,199,8,11,199,196,109,
+234,119,160,183,139,161,100,57,140,78,223,118,141,187,112,62,215,216,134,6,113,242,172,32,26,26,117,188,76,229,
+241,83,72,74,60,67,247,105,246,188,47,154,171,232,19,105,4,72,109,68,44,166,66,12,203,68,199,169,99,60,
+122,1,139,56,206,205,106,113,217,167,176,236,115,102,33,12,63,139,249,124,122,15,248,125,33,143,229,217,216,9,
+126,98,222,190,155,17,54,133,44,147,215,2,193,238,9,126,226,8,96,54,236,67,141,73,7,250,212,206,236,25,
+15,208,213,50,53,81,135,86,86,61,149,233,93,30,215,49,54,99,36,82,163,42,76,150,59,113,131,35,86,53,
+126,17,7,145,27,105,131,14,163,118,172,235,108,182,146,193,123,221,220,49,119,154,113,203,102,166,23,101,211,9,
+53,12,6,131,12,237,170,219,250,246,174,222,93,10,248,224,36,3,62,131,208,13,180,109,28,241,145,169,162,89,
+114,207,157,198,72,100,213,39,20,172,29,103,32,221,210,13,133,69,8,139,92,206,212,50,24,239,247,251,186,25,
+239,124,56,36,85,185,153,30,165,188,40,38,247,6,70,172,60,157,168,44,68,207,244,123,234,75,116,48,192,185,
+249,82,164,74,113,156,237,53,22,179,70,62,241,232,254,21,73,81,89,255,145,227,125,190,194,164,210,164,15,157,
+122,150,114,229,70,182,46,227,229,73,65,145,88,38,24,173,84,228,55,9,23,47,242,91,44,214,51,132,215,86,
+132,26,197,242,1,139,141,145,242,194,217,86,202,7,47,38,97,11,51,226,9,165,144,35,31,96,241,165,0,223,
+181,45,147,252,96,236,14,26,116,16,46,75,36,155,229,184,75,85,239,239,232,187,115,91,239,211,184,115,144,219,
+56,208,67,223,66,241,51,143,79,236,161,195,18,24,144,65,71,174,109,178,220,142,181,52,235,248,153,139,101,148,
+130,6,104,43,101,176,148,105,149,95,199,96,161,231,193,38,211,206,231,173,106,76,85,40,243,207,172,82,238,67,
+38,134,118,42,60,124,162,217,4,114,192,25,232,178,68,83,58,214,45,187,68,187,169,87,166,21,76,14,104,137,
+102,38,204,49,74,54,91,3,35,54,149,192,41,232,165,56,165,101,90,241,69,159,18,13,249,42,75,78,195,101,
+215,26,119,26,25,169,146,152,140,196,70,9,55,231,84,42,165,116,19,3,37,244,196,56,10,196,50,57,174,156,
+198,220,46,166,78,225,186,41,164,110,109,156,1,71,169,85,233,164,35,99,110,35,230,73,233,201,77,188,56,43,
+178,177,238,16,240,117,85,178,76,28,203,187,223,208,58,94,83,37,17,116,185,86,121,52,150,7,104,148,23,46,
+85,125,242,40,192,65,242,142,110,152,127,3,79,92,110,64,167,208,174,108,191,146,214,10,175,144,73,111,5,204,
+74,154,69,238,37,147,96,17,192,74,106,249,78,42,147,86,126,243,213,122,203,119,75,217,122,203,111,191,146,86,
+129,183,204,164,85,208,190,20,173,117,251,182,2,166,52,205,66,223,93,72,185,16,178,196,24,180,215,27,130,207,
+166,84,24,78,50,137,21,66,172,164,87,24,149,50,233,21,66,100,210,123,202,88,53,105,178,197,216,116,40,19,
+123,63,233,150,5,14,245,21,75,241,74,186,213,120,227,242,206,117,45,168,146,116,203,58,218,181,33,75,210,47,
+229,116,215,3,43,73,185,132,3,94,7,168,172,158,75,56,172,181,160,74,210,45,227,152,215,130,90,131,238,243,
+250,252,28,87,157,143,165,156,195,126,38,124,233,49,110,63,103,136,127,35,213,114,142,124,77,184,146,180,203,57,
+245,53,225,10,104,231,56,248,12,183,205,38,239,188,36,68,82,122,250,186,26,120,149,87,93,137,160,208,45,174,
+132,46,112,109,171,251,93,48,88,87,2,23,121,153,82,192,223,76,125,245,88,47,161,249,231,195,22,15,182,149,
+224,197,227,37,19,252,41,119,30,46,214,114,51,119,181,235,108,67,89,89,52,42,170,44,59,122,214,75,106,74,
+162,120,214,72,90,51,205,40,137,99,221,81,181,94,240,47,137,98,237,17,182,126,72,94,19,205,51,70,219,90,
+161,177,36,134,103,140,188,117,227,85,1,146,167,196,254,201,242,136,145,239,117,24,147,32,177,181,6,73,1,212,
+138,113,81,0,89,52,20,10,192,242,173,191,168,111,249,102,86,0,85,96,227,43,160,158,79,111,165,37,23,106,
+240,25,64,133,246,90,0,87,104,162,41,184,167,104,105,117,217,36,121,19,126,118,164,164,61,230,129,172,48,198,
+60,176,34,75,204,131,201,55,195,220,254,228,219,68,30,72,129,1,22,129,60,147,210,74,211,203,215,212,186,16,
+133,70,151,7,84,104,113,113,160,197,65,74,190,221,25,59,143,180,216,47,213,251,144,156,76,3,218,13,220,137,
+56,44,141,167,111,148,174,139,27,203,193,99,108,101,63,190,193,168,250,68,52,88,108,52,86,217,142,49,223,59,
+206,220,148,44,9,51,151,249,14,24,59,220,154,177,177,43,142,11,49,126,99,7,184,194,116,139,237,13,199,48,
+176,211,95,124,240,177,158,133,39,188,98,77,14,18,17,67,236,150,100,75,72,9,197,19,219,24,97,27,135,124,
+183,25,135,106,150,188,150,119,212,163,29,130,197,46,104,238,214,252,183,65,103,183,168,146,226,227,0,229,161,86,
+242,178,84,45,185,158,197,182,145,254,65,152,197,229,87,68,167,30,196,109,39,203,200,56,167,96,27,244,151,205,
+58,158,134,234,230,87,101,104,157,15,34,246,149,29,90,220,146,117,3,205,236,169,144,144,132,103,73,182,8,187,
+7,102,83,145,219,57,68,151,155,229,203,130,40,221,172,194,36,203,145,19,248,188,216,155,198,211,113,236,30,150,
+236,28,105,17,96,162,243,221,97,158,149,131,122,181,183,205,133,92,233,112,255,150,98,37,203,190,53,229,57,51,
+14,0,229,157,199,72,111,215,118,87,212,175,226,36,150,228,150,216,27,230,167,136,194,147,24,107,30,4,107,54,
+155,223,194,13,215,48,30,166,122,62,14,242,127,36,125,136,184,60,115,25,192,121,94,156,31,44,173,71,103,62,
+226,155,234,169,163,67,145,171,199,131,71,121,122,207,84,54,215,240,226,158,129,216,198,122,124,191,189,104,135,127,
+158,188,115,133,73,173,195,110,108,161,230,86,234,182,150,176,60,163,215,81,52,207,56,84,88,72,227,21,48,226,
+228,16,98,117,25,33,90,156,10,224,71,122,27,120,50,173,204,105,44,33,18,181,149,58,29,198,10,82,241,54,
+51,39,105,243,160,211,205,44,252,75,14,188,39,197,194,196,17,222,114,146,85,149,60,22,254,242,101,70,146,33,
+210,11,110,165,226,184,5,158,141,19,166,131,135,48,194,147,181,248,61,60,30,166,172,47,145,213,90,207,238,74,
+86,67,158,162,22,24,73,14,170,68,19,46,157,228,41,149,22,76,148,190,55,159,225,73,53,53,90,153,107,233,
+248,153,151,69,176,28,196,68,44,138,7,172,176,104,190,90,44,203,28,21,120,128,92,153,197,59,36,150,61,74,
+128,230,156,56,45,1,154,39,133,186,172,168,203,130,96,165,105,172,139,67,195,165,149,186,128,200,20,227,234,163,
+82,82,206,134,68,14,25,238,225,214,131,201,239,204,211,179,120,40,165,182,188,45,244,112,82,211,196,207,242,141,
+145,217,241,36,86,255,141,33,37,194,196,185,231,217,54,52,244,182,254,173,113,227,175,136,2,5,125,77,25,115,
+74,254,236,158,118,106,130,43,223,90,134,44,17,51,18,19,83,17,40,218,177,64,209,78,4,138,60,239,151,58,
+31,88,95,28,247,99,83,237,70,246,241,114,152,232,165,230,248,243,103,247,113,41,109,93,203,189,230,217,116,114,
+40,103,40,37,121,187,201,170,113,53,207,29,34,185,248,81,124,18,59,242,206,238,59,107,69,209,92,141,148,164,
+226,119,161,1,4,200,12,5,97,3,134,168,176,5,207,111,151,2,66,234,96,141,154,187,55,21,201,217,115,3,
+72,169,55,155,138,73,135,113,249,39,203,23,51,13,144,223,64,55,168,196,110,161,103,247,248,133,135,235,11,170,
+114,167,111,152,42,231,172,17,44,170,242,53,146,82,125,210,7,167,37,180,226,12,82,126,195,12,250,56,212,2,
+124,124,135,131,43,191,133,118,81,175,47,12,131,153,67,56,69,200,183,140,248,89,95,6,152,184,79,170,148,222,
+147,247,37,164,85,186,155,163,234,221,191,163,170,19,162,46,59,214,75,40,191,104,74,38,251,51,43,48,70,85,
+241,151,252,248,84,246,30,143,191,230,174,91,193,134,88,197,76,221,169,19,175,140,207,153,67,25,126,126,138,2,
+57,55,62,37,180,60,165,4,244,194,251,113,65,103,228,147,237,166,177,99,212,215,71,21,198,204,245,1,121,56,
+225,247,78,183,241,70,162,103,98,200,205,141,147,8,69,207,51,238,246,77,164,41,203,233,14,23,119,35,62,167,
+195,48,81,28,131,26,237,173,116,164,110,69,161,90,172,107,40,171,110,6,35,74,120,143,80,119,85,125,246,125,
+73,139,59,1,112,26,154,41,144,108,253,37,4,92,184,33,145,41,68,113,203,113,220,61,42,145,123,140,38,141,
+241,121,180,148,147,187,96,147,168,159,213,216,202,28,137,10,51,206,241,43,114,61,93,27,91,249,174,47,139,245,
+239,69,40,155,192,191,16,241,243,251,90,100,103,57,83,162,70,187,90,223,222,174,214,91,77,124,68,67,107,107,
+94,96,142,25,207,70,170,227,39,243,196,142,120,66,68,246,147,46,240,81,16,226,25,25,236,57,25,75,79,194,
+104,242,6,139,103,97,100,60,42,163,251,47,165,54,47,114,139,60,163,14,131,43,91,164,21,114,99,123,37,157,
+80,5,121,137,187,42,55,151,83,119,86,88,82,105,153,204,173,96,234,59,243,20,202,74,105,71,54,148,197,86,
+116,79,115,24,18,147,119,83,175,64,143,170,88,29,175,150,136,136,21,184,117,32,203,198,60,177,116,32,30,130,
+149,120,52,15,47,75,47,226,39,247,78,66,192,236,110,171,173,86,53,252,175,200,187,91,241,123,207,194,123,203,
+90,11,7,31,63,76,55,80,241,147,241,124,128,216,202,122,120,255,104,216,231,194,211,168,137,199,163,164,178,168,
+229,6,203,209,188,244,125,122,137,251,238,98,253,21,33,181,222,74,222,89,183,76,60,227,70,215,130,39,188,164,
+159,212,180,140,46,122,220,19,72,22,133,57,117,28,148,23,142,25,227,110,113,223,118,34,53,233,252,96,168,134,
+98,168,241,158,149,64,29,140,166,227,126,98,198,29,207,124,132,48,154,153,17,61,78,59,107,182,202,213,177,250,
+222,190,117,239,254,43,186,227,47,7,87,142,232,243,111,239,207,157,21,65,199,73,43,107,78,20,86,8,163,145,
+90,226,136,104,134,185,60,45,13,158,217,200,10,178,181,133,211,16,118,241,93,116,159,253,104,185,76,147,78,144,
+254,143,48,146,216,226,26,106,47,67,38,5,143,194,11,157,224,96,176,244,248,183,122,38,46,118,107,121,145,78,
+115,151,202,51,42,184,10,182,153,159,90,158,30,231,16,103,15,238,180,221,89,34,200,116,126,216,217,217,41,132,
+96,143,103,73,64,152,166,153,219,193,255,4,203,137,158,68,138,207,56,34,16,128,246,43,184,219,93,33,35,143,
+14,246,43,166,30,232,29,107,172,15,105,237,129,109,131,119,241,129,186,219,205,170,166,105,61,77,59,214,142,225,
+55,254,61,212,122,110,239,74,211,78,134,112,121,136,191,180,43,252,117,166,133,245,225,207,177,150,252,73,94,223,
+105,71,95,181,163,243,224,213,80,171,61,52,21,237,250,215,247,154,118,52,58,122,117,165,121,63,213,223,3,209,
+25,92,223,214,107,87,61,70,160,55,132,235,222,201,197,96,120,164,217,191,0,54,231,205,84,59,170,157,126,25,
+246,14,191,78,46,180,47,218,145,175,29,254,124,167,206,180,193,248,190,169,189,189,59,189,7,176,243,35,77,163,
+246,253,157,214,220,246,93,237,80,161,247,87,218,105,111,102,104,63,215,119,7,90,111,251,253,238,236,240,173,118,
+169,104,87,230,235,247,172,126,168,221,159,122,77,237,205,229,185,14,252,77,95,177,46,94,104,167,147,219,38,212,
+15,30,52,237,151,227,159,53,237,203,240,8,232,155,189,246,85,239,245,24,25,188,2,9,29,106,67,214,28,57,
+70,129,29,31,157,125,25,106,39,189,199,51,237,236,117,239,76,187,124,61,249,73,59,188,212,46,219,218,233,225,
+155,29,237,205,235,235,187,43,173,121,85,123,175,189,54,190,94,65,39,175,126,213,52,243,236,244,78,187,186,176,
+222,105,71,239,30,106,26,240,211,254,5,250,115,62,211,206,218,90,91,59,250,69,125,59,212,206,62,254,250,6,
+197,14,242,174,61,184,138,118,118,122,40,40,247,142,109,166,143,222,80,59,254,200,132,250,135,101,104,23,181,211,
+93,184,254,153,169,19,148,5,248,30,180,222,219,166,49,211,134,87,0,122,243,70,1,126,125,109,168,245,46,176,
+254,13,125,215,215,222,213,106,181,217,145,227,61,186,90,255,184,13,242,241,181,250,213,209,157,119,51,212,46,166,
+141,150,118,216,28,204,180,222,236,195,53,8,117,242,174,161,245,38,219,3,196,135,244,119,107,64,11,4,162,253,
+247,231,191,63,255,253,249,119,254,156,240,63,94,162,240,176,247,26,6,232,224,227,44,89,122,121,172,189,253,248,
+16,243,213,135,103,218,225,201,123,229,182,30,24,218,225,108,202,202,122,103,250,71,173,247,171,118,212,250,73,59,
+50,106,71,124,144,127,56,185,118,57,76,111,118,116,244,85,225,95,135,218,57,252,121,228,33,192,71,159,165,189,
+181,126,125,115,105,29,187,239,143,102,191,246,102,215,199,189,19,128,59,84,110,47,102,224,174,122,163,43,248,237,
+92,221,25,63,65,211,63,46,110,236,219,15,22,11,49,224,207,193,55,137,159,203,107,243,72,187,14,174,175,175,
+127,253,57,44,59,123,80,40,132,129,217,209,201,245,73,172,79,245,171,247,195,171,55,87,189,155,180,92,110,223,
+55,139,5,247,110,4,238,247,72,107,128,140,172,55,109,112,138,195,1,48,234,30,99,40,58,4,86,142,175,142,
+152,231,95,200,240,138,73,226,35,252,247,53,232,197,217,217,27,244,129,239,129,253,25,196,16,237,29,124,52,109,
+191,114,176,87,227,143,82,199,167,86,31,236,141,212,131,227,155,119,13,149,124,212,97,34,110,186,67,168,86,15,
+246,38,196,50,247,43,126,160,7,83,191,66,216,115,22,247,43,241,71,122,34,158,201,193,158,105,221,135,181,48,
+169,174,36,10,240,32,179,191,141,15,92,15,15,148,17,150,7,136,231,180,39,207,149,181,148,232,113,45,245,251,
+209,98,58,137,223,163,61,113,69,222,105,209,113,183,130,220,189,180,221,33,36,26,234,75,194,78,148,98,218,73,
+194,187,106,128,102,45,36,138,223,129,171,131,61,182,52,151,228,141,184,14,127,30,20,222,9,26,76,61,135,12,
+116,219,167,221,74,113,207,226,199,250,194,94,238,177,66,18,123,214,17,2,26,119,219,77,254,76,42,38,208,145,
+27,248,19,55,248,221,247,45,179,66,248,230,16,242,89,33,247,186,61,165,41,8,65,45,188,37,3,104,240,117,
+18,232,72,10,213,193,41,191,34,55,55,103,71,123,53,214,236,64,116,251,25,124,79,157,59,199,157,57,156,231,
+153,53,176,242,25,94,52,45,100,54,194,113,240,241,236,228,44,139,205,37,102,191,191,212,39,179,239,37,116,196,
+180,144,249,59,113,243,202,95,33,247,60,150,215,16,59,227,149,73,61,135,209,103,72,190,145,205,127,91,225,172,
+251,212,187,167,222,239,252,237,12,137,39,138,135,252,99,203,66,214,227,40,14,110,216,5,121,7,23,107,8,57,
+135,201,122,189,165,42,130,81,60,115,235,218,244,247,190,62,53,115,56,13,155,143,45,103,191,178,187,205,190,234,
+15,240,85,173,179,139,194,94,36,240,31,28,242,43,210,131,171,252,126,44,120,143,225,9,240,213,30,32,136,91,
+246,151,244,92,61,166,69,190,104,200,250,35,218,133,168,82,11,157,232,238,152,159,68,207,238,122,148,99,219,220,
+234,98,133,49,194,121,41,212,140,220,89,84,113,176,135,15,65,118,157,80,26,74,229,128,17,39,202,94,141,215,
+64,15,56,3,223,197,156,194,19,101,192,10,215,16,46,201,78,39,191,227,65,253,223,249,154,156,80,5,190,211,
+65,168,98,91,97,223,253,128,78,64,95,248,53,212,29,175,112,29,134,60,129,76,230,77,150,209,243,138,74,45,
+219,118,56,194,20,99,121,150,179,196,86,218,86,50,57,75,240,177,191,196,114,210,48,226,92,28,156,179,11,114,
+11,23,207,26,38,75,194,55,92,232,55,184,153,12,241,55,148,72,254,236,123,182,2,212,148,6,18,24,69,23,
+179,168,20,107,65,141,212,144,0,206,83,132,186,134,38,242,185,217,207,96,62,61,220,227,204,192,120,231,151,223,
+81,35,144,186,121,65,159,234,193,239,134,59,117,130,148,78,22,250,88,244,53,102,140,177,62,166,176,136,238,101,
+227,94,49,30,50,217,202,29,16,69,130,47,34,191,159,201,113,42,54,167,120,56,56,13,11,200,33,22,80,239,
+47,139,123,106,93,86,118,100,101,87,174,171,92,30,131,25,196,43,124,21,210,55,4,239,8,199,193,137,229,141,
+217,187,154,62,240,146,124,91,226,251,105,73,68,148,109,142,252,142,105,192,49,251,26,203,245,5,158,190,199,255,
+243,75,114,57,24,144,132,5,46,14,48,177,222,69,8,137,216,147,131,14,122,83,166,76,195,182,140,59,12,223,
+193,199,163,27,118,12,139,69,17,60,223,20,242,200,182,239,112,254,128,133,64,204,33,153,138,169,97,190,94,70,
+75,139,140,138,63,86,149,36,30,22,203,24,102,169,221,239,253,32,18,121,226,241,176,30,53,73,248,250,32,194,
+107,38,83,143,189,197,43,124,162,111,172,107,222,212,185,70,124,188,99,86,136,49,245,250,38,118,176,5,59,126,
+63,36,248,166,170,158,11,3,19,55,60,212,38,252,131,138,137,30,140,8,240,118,81,87,201,246,125,195,110,74,
+236,115,223,48,164,166,220,84,137,34,181,73,67,110,181,225,79,155,61,121,188,181,35,55,183,161,72,105,192,5,
+96,105,202,234,246,249,182,188,67,234,77,185,109,72,114,179,37,201,237,134,36,239,72,117,121,103,23,255,170,50,
+64,74,13,185,81,39,170,188,189,43,109,147,109,105,251,235,24,96,182,1,197,78,243,188,190,35,55,200,174,172,
+26,114,19,112,52,17,23,128,194,31,6,73,16,82,66,72,132,3,38,165,134,13,2,98,31,248,110,112,54,73,
+91,66,54,9,50,170,72,200,38,176,178,45,33,159,18,242,41,33,159,95,209,127,212,64,22,240,219,58,96,226,
+11,147,24,174,167,188,60,168,80,173,248,202,22,99,48,204,87,236,74,93,34,6,200,202,6,214,240,187,105,115,
+151,180,153,148,70,13,99,73,130,32,16,165,206,164,180,11,82,82,91,168,33,80,148,13,5,77,84,73,115,251,
+176,13,85,164,190,43,183,154,164,174,200,205,6,81,65,247,42,252,94,22,247,8,213,33,53,191,94,0,168,106,
+44,41,154,112,98,4,137,1,45,212,41,144,66,34,140,220,97,189,133,166,212,100,148,1,229,14,168,21,8,53,
+51,204,239,180,110,51,165,75,205,211,148,38,207,65,126,132,11,48,210,100,174,190,124,80,199,183,233,11,49,124,
+103,125,237,144,198,105,203,0,145,212,81,51,42,145,119,225,151,122,95,111,26,40,186,186,220,222,37,42,126,70,
+80,2,215,136,67,146,161,76,82,63,236,112,249,143,165,22,169,111,35,138,237,109,28,111,240,165,209,132,63,13,
+159,127,33,13,252,79,240,130,224,5,255,130,101,95,199,112,165,156,182,62,180,70,117,229,190,153,148,237,13,244,
+181,188,108,153,139,59,190,121,247,189,189,28,160,252,142,142,174,253,161,105,115,87,209,190,7,107,106,126,104,103,
+121,6,182,32,149,246,12,226,55,91,181,34,123,190,225,89,147,224,96,163,86,131,174,240,96,70,194,247,168,224,
+251,3,217,139,7,209,193,248,85,246,46,65,182,246,131,83,27,159,93,242,25,11,123,105,35,221,184,215,61,194,
+39,78,62,217,39,159,62,119,89,9,54,118,196,124,107,159,40,221,141,193,212,49,216,84,40,4,14,103,73,228,
+105,67,44,30,77,116,207,167,103,78,176,25,190,68,81,134,6,199,236,213,145,65,239,241,204,220,12,39,104,91,
+60,129,217,34,127,254,137,168,231,49,228,241,137,25,96,102,204,1,3,130,193,79,49,182,128,81,107,176,249,34,
+216,18,228,187,27,129,204,231,3,152,111,2,12,252,172,230,40,62,131,8,217,66,76,97,46,27,226,90,141,41,
+153,253,198,113,177,212,172,7,153,216,161,19,148,195,149,78,230,226,216,120,250,97,242,14,194,79,46,146,40,79,
+217,146,69,162,146,148,117,108,170,11,162,78,106,60,173,229,238,122,170,88,71,222,136,51,166,185,114,192,97,234,
+191,54,142,204,73,93,28,75,92,243,101,241,60,7,65,142,142,25,138,184,197,148,71,145,213,155,146,152,50,108,
+133,129,11,99,75,216,77,148,1,138,1,250,128,239,188,132,230,14,157,145,159,47,206,79,225,234,154,254,49,165,
+62,179,27,86,43,187,19,234,108,86,94,31,223,86,170,164,82,99,238,250,159,220,146,246,43,228,213,146,185,225,
+65,84,102,239,28,218,167,142,137,184,50,184,96,30,250,219,24,1,20,149,82,4,111,70,211,0,53,251,13,4,
+125,129,226,219,58,31,159,95,108,112,86,220,254,23,96,228,105,222,221,128,111,114,144,63,142,177,26,119,54,208,
+62,214,243,29,201,85,51,8,62,66,6,94,129,4,60,209,255,119,151,55,40,128,151,181,153,201,136,191,92,116,
+178,86,187,161,236,37,186,236,229,192,19,234,17,220,160,129,63,150,131,97,139,191,136,87,183,93,103,72,96,118,
+55,98,13,61,78,130,225,7,89,8,138,167,12,110,179,114,40,158,68,127,11,105,2,10,29,223,52,101,25,12,
+81,237,139,15,41,67,200,153,131,27,38,143,140,31,190,254,7,29,9,101,140,58,38,16,95,15,49,150,234,139,
+98,50,27,81,135,7,81,38,67,14,231,203,224,0,201,38,190,8,88,102,56,111,184,128,247,247,83,66,145,143,
+46,223,30,147,255,249,31,246,206,96,153,111,48,177,102,170,162,160,81,1,65,209,146,12,44,199,242,71,212,148,
+201,145,139,146,49,168,239,227,139,140,241,5,200,242,134,88,90,5,159,55,12,201,250,19,40,163,248,162,77,102,
+44,115,33,29,48,158,55,55,151,111,129,24,30,75,178,6,143,155,96,1,91,73,123,138,79,4,54,202,152,54,
+240,201,141,115,65,22,100,13,173,95,166,101,253,114,49,12,86,9,27,113,174,234,85,224,61,66,195,53,68,29,
+27,29,117,160,199,4,193,194,111,38,250,20,7,8,36,2,31,31,93,88,32,179,137,27,23,86,145,107,142,239,
+79,69,14,25,7,31,84,221,64,213,91,189,56,60,196,246,90,50,225,223,205,204,2,240,104,203,41,9,140,229,
+43,40,47,182,77,150,33,139,105,198,55,45,146,176,188,6,55,48,10,35,106,108,183,32,9,47,170,112,231,0,
+140,96,145,172,50,125,220,138,75,200,37,23,201,43,223,18,40,240,111,97,34,10,78,141,31,138,102,39,30,241,
+181,231,0,85,169,224,75,176,189,77,68,101,177,236,23,254,236,133,137,143,108,83,103,24,140,160,236,213,171,173,
+16,92,55,205,77,28,41,151,108,83,96,179,194,119,9,208,185,91,85,98,109,69,116,194,94,197,179,173,52,106,
+242,207,68,117,7,115,228,196,190,4,27,221,6,38,254,100,147,122,158,235,161,153,135,150,203,10,68,49,107,153,
+29,136,0,147,193,140,56,47,244,45,156,128,186,210,11,168,133,110,0,23,255,66,55,160,150,240,3,185,74,139,
+150,4,99,25,78,122,24,119,23,29,86,83,61,142,192,147,61,86,51,35,108,108,170,77,178,34,108,204,13,100,
+151,198,199,57,75,214,215,242,21,185,232,96,8,242,212,127,29,207,177,140,45,244,3,225,52,162,188,35,201,198,
+181,96,107,37,174,66,182,34,71,81,118,2,151,225,116,182,150,241,198,28,8,67,92,102,58,183,236,141,182,150,
+114,32,164,115,187,240,71,98,24,63,55,53,98,11,68,140,223,255,102,71,127,131,236,8,168,221,158,158,221,16,
+248,119,114,121,77,110,110,175,143,181,139,179,183,175,161,244,152,156,95,190,230,75,43,98,147,25,132,14,68,29,
+112,241,62,1,57,88,248,103,198,94,224,137,120,128,60,88,153,79,216,77,59,12,204,214,161,19,236,9,28,196,
+50,161,57,25,186,1,147,210,139,23,51,203,129,25,130,124,140,149,55,238,212,51,104,232,129,160,59,188,64,88,
+85,172,201,102,165,6,181,208,11,170,143,81,131,139,166,24,154,88,187,115,203,7,189,163,5,64,29,40,126,161,
+202,5,122,116,212,69,65,83,156,56,138,70,47,227,201,114,40,179,125,0,150,125,48,165,96,179,246,155,247,231,
+111,222,111,206,159,191,57,53,17,72,216,252,20,90,177,214,97,4,197,69,3,94,113,16,106,184,44,109,17,165,
+231,229,1,94,237,19,42,227,89,107,136,201,149,223,28,4,174,242,227,78,161,178,109,235,62,180,91,119,144,92,
+39,99,107,105,85,92,46,35,252,13,135,98,136,17,28,144,62,106,222,228,137,7,66,163,91,101,75,105,149,240,
+70,38,28,102,225,170,0,126,103,107,118,96,110,248,29,237,230,158,189,112,185,242,25,179,132,224,12,247,234,128,
+231,205,197,160,218,36,107,205,55,87,6,216,172,193,248,34,103,48,66,86,21,31,140,47,196,96,92,44,244,132,
+189,198,129,186,42,189,14,87,144,120,123,121,177,144,148,154,162,46,175,38,197,140,179,242,14,111,73,96,153,213,
+102,32,79,216,197,63,73,5,215,129,59,240,103,48,168,108,161,130,171,172,69,164,142,79,1,159,243,126,38,175,
+54,160,146,141,190,197,234,73,136,13,28,136,65,143,77,16,88,13,159,95,160,108,201,129,123,98,61,80,115,179,
+206,144,18,24,192,67,183,194,216,139,150,121,192,120,65,30,140,61,176,177,10,62,115,83,84,32,218,11,61,24,
+201,6,181,236,56,132,64,47,112,226,221,186,21,150,76,177,87,255,206,32,146,141,88,2,136,254,204,5,150,200,
+24,98,14,168,65,231,174,53,226,123,98,129,167,241,249,18,48,53,57,91,224,11,251,148,43,170,158,96,11,185,
+9,171,223,79,24,109,209,118,58,9,107,255,152,186,222,116,204,234,28,74,77,176,220,238,50,10,190,204,230,179,
+86,226,123,21,112,68,221,29,216,46,100,160,66,203,83,124,139,56,77,118,185,82,52,137,224,135,46,65,246,64,
+87,196,42,225,94,186,121,185,172,128,201,91,55,169,50,218,4,190,238,213,196,202,249,98,9,125,193,7,216,188,
+247,120,195,76,209,245,52,219,222,172,44,63,125,20,184,130,160,123,172,27,163,197,224,220,180,183,158,108,153,237,
+13,160,131,101,19,129,10,191,165,21,220,240,124,171,27,35,89,195,215,54,31,144,255,7,140,9,13,45,103,137,
+0,0
+};
+
+#endif
@@ -47,12 +47,11 @@ class WiFiMan : public Singleton <WiFiMan>
    protected:
       WiFiMan () : m_server(NULL), m_servelocal(false) { }
    private:
-     void handleSerialData();
      AsyncWebServer*          m_server;
      bool startServe();
      bool m_servelocal;
 
-     static void recvMsg(uint8_t *data, size_t len);
+     static void recvMsg(uint32_t client, const uint8_t *data, size_t len, bool last);
 };
 
 #endif
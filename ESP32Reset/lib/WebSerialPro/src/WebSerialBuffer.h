@@ -0,0 +1,302 @@
+#ifndef WebSerialBuffer_h
+#define WebSerialBuffer_h
+
+// Output side of WebSerialPro without the web server, so it also builds on
+// the host for the benchmark in sim/. Output is collected until a frame is
+// worth sending and slow clients skip frames instead of queueing them. The
+// last frames are kept as scrollback for clients that connect later.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef WEBSERIAL_FRAME_SIZE
+#define WEBSERIAL_FRAME_SIZE 1024 // flushed once this much is collected
+#endif
+#ifndef WEBSERIAL_FLUSH_MS
+#define WEBSERIAL_FLUSH_MS 20 // oldest byte waits at most this long
+#endif
+#define WEBSERIAL_MAX_CLIENTS 4
+#define WEBSERIAL_NOTICE_SIZE 48
+#define WEBSERIAL_INPUT_WINDOW 2048 // unacknowledged input a page may have sent, see webserial_webpage.h
+#ifndef WEBSERIAL_SCROLLBACK_SIZE
+#define WEBSERIAL_SCROLLBACK_SIZE 32768 // output kept for replay, in PSRAM if the board has it
+#endif
+#define WEBSERIAL_REPLAY_FRAME 2048 // scrollback is replayed in frames of up to this size
+#define WEBSERIAL_OFFSET_NONE UINT64_MAX // the client asked for no offset, it gets all scrollback
+
+// binary frames to the page: a type byte and a little-endian value
+#define WEBSERIAL_FRAME_ACK 1    // uint32_t, input bytes taken so far
+#define WEBSERIAL_FRAME_OFFSET 2 // uint64_t, stream offset of the next text byte
+
+typedef void (*WebSerialFlush)(void * arg, const char * data, size_t len);
+
+class WebSerialBuffer {
+  public:
+    WebSerialBuffer(WebSerialFlush flush, void * arg) : _flush(flush), _arg(arg), _len(0), _since(0), _frames(0), _bytes(0) {}
+
+    void write(const char * data, size_t len, unsigned long now) {
+      while(len) {
+        if(!_len)
+          _since = now;
+        size_t n = len < WEBSERIAL_FRAME_SIZE - _len ? len : WEBSERIAL_FRAME_SIZE - _len;
+        memcpy(_data + _len, data, n);
+        _len += n;
+        data += n;
+        len -= n;
+        if(_len == WEBSERIAL_FRAME_SIZE)
+          _send(completeUtf8(_data, _len));
+      }
+    }
+
+    // numbers are formatted in place, no String
+    void writeNumber(long value, unsigned long now) {
+      char buf[24];
+      write(buf, snprintf(buf, sizeof(buf), "%ld", value), now);
+    }
+
+    void writeNumber(unsigned long value, unsigned long now) {
+      char buf[24];
+      write(buf, snprintf(buf, sizeof(buf), "%lu", value), now);
+    }
+
+    void writeNumber(double value, unsigned long now) {
+      char buf[32];
+      int n = snprintf(buf, sizeof(buf), "%.2f", value);
+      write(buf, n < (int)sizeof(buf) ? n : sizeof(buf) - 1, now);
+    }
+
+    // sends what is collected once the oldest byte waited long enough; a
+    // character cut off at the end waits for the rest of it one more period
+    void iterate(unsigned long now) {
+      if(!_len || now - _since < WEBSERIAL_FLUSH_MS)
+        return;
+      size_t complete = completeUtf8(_data, _len);
+      _send(complete ? complete : _len);
+      _since = now;
+    }
+
+    void flush() {
+      _send(_len);
+    }
+
+    // length of data without a UTF-8 sequence cut off at its end, frames
+    // are sent as text and browsers close the socket on a broken one
+    static size_t completeUtf8(const char * data, size_t len) {
+      size_t i = len;
+      while(i > 0 && len - i < 3 && ((uint8_t)data[i - 1] & 0xC0) == 0x80)
+        i--;
+      if(i == 0)
+        return len;
+      uint8_t lead = data[i - 1];
+      size_t need = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+      return len - (i - 1) < need ? i - 1 : len;
+    }
+
+    uint32_t frames() const { return _frames; }
+    uint32_t bytes() const { return _bytes; }
+
+  private:
+    void _send(size_t n) {
+      if(!n)
+        return;
+      _flush(_arg, _data, n);
+      _frames++;
+      _bytes += n;
+      _len -= n;
+      memmove(_data, _data + n, _len);
+    }
+
+    WebSerialFlush _flush;
+    void * _arg;
+    char _data[WEBSERIAL_FRAME_SIZE];
+    size_t _len;
+    unsigned long _since;
+    uint32_t _frames;
+    uint32_t _bytes;
+};
+
+// the last frames sent, addressed by their offset in the output since boot;
+// a client that reconnects asks for the offset it has got up to
+class WebSerialScrollback {
+  public:
+    WebSerialScrollback() : _data(NULL), _size(0), _end(0) {}
+
+    // without a buffer only the offsets are counted
+    void begin(char * data, size_t size) {
+      _data = data;
+      _size = data ? size : 0;
+    }
+
+    void write(const char * data, size_t len) {
+      uint64_t end = _end + len;
+      if(_size) {
+        if(len > _size) {
+          data += len - _size;
+          len = _size;
+        }
+        size_t pos = (end - len) % _size;
+        size_t first = len < _size - pos ? len : _size - pos;
+        memcpy(_data + pos, data, first);
+        memcpy(_data, data + first, len - first);
+      }
+      _end = end;
+    }
+
+    uint64_t start() const { return _end > _size ? _end - _size : 0; }
+    uint64_t end() const { return _end; }
+
+    // the first character boundary at or after offset
+    uint64_t align(uint64_t offset) const {
+      for(int i = 0; i < 3 && offset < _end && (_at(offset) & 0xC0) == 0x80; i++)
+        offset++;
+      return offset;
+    }
+
+    // length of the next replay frame from offset, ends on a character boundary
+    size_t frame(uint64_t offset, size_t max) const {
+      size_t n = _end - offset < max ? _end - offset : max;
+      for(int i = 0; i < 3 && n > 1 && offset + n < _end && (_at(offset + n) & 0xC0) == 0x80; i++)
+        n--;
+      return n;
+    }
+
+    void read(uint64_t offset, char * out, size_t len) const {
+      size_t pos = offset % _size;
+      size_t first = len < _size - pos ? len : _size - pos;
+      memcpy(out, _data + pos, first);
+      memcpy(out + first, _data, len - first);
+    }
+
+  private:
+    uint8_t _at(uint64_t offset) const { return _data[offset % _size]; }
+
+    char * _data;
+    size_t _size;
+    uint64_t _end;
+};
+
+// per-client backpressure: a client whose send queue is full misses frames,
+// the data it lost is counted and reported to it with the next frame it gets.
+// A new client first gets the scrollback and is live once it has caught up.
+class WebSerialClients {
+  public:
+    WebSerialClients() : _dropped(0) {
+      for(int i = 0; i < WEBSERIAL_MAX_CLIENTS; i++)
+        _clients[i].id = 0;
+    }
+
+    // offset: where the client wants the output to start, WEBSERIAL_OFFSET_NONE for all
+    void add(uint32_t id, uint64_t offset = WEBSERIAL_OFFSET_NONE) {
+      for(int i = 0; i < WEBSERIAL_MAX_CLIENTS; i++) {
+        if(!_clients[i].id) {
+          _clients[i].dropped = 0;
+          _clients[i].acked = 0;
+          _clients[i].offset = offset;
+          _clients[i].state = CLIENT_REQUESTED;
+          _clients[i].id = id;
+          return;
+        }
+      }
+    }
+
+    void remove(uint32_t id) {
+      for(int i = 0; i < WEBSERIAL_MAX_CLIENTS; i++)
+        if(_clients[i].id == id)
+          _clients[i].id = 0;
+    }
+
+    uint32_t id(int slot) const { return _clients[slot].id; }
+    bool live(int slot) const { return _clients[slot].state == CLIENT_LIVE; }
+
+    // the next client to replay scrollback to, -1 if none
+    int replaying() const {
+      for(int i = 0; i < WEBSERIAL_MAX_CLIENTS; i++)
+        if(_clients[i].id && _clients[i].state != CLIENT_LIVE)
+          return i;
+      return -1;
+    }
+
+    // before each replay step: the first time, the offset the client asked
+    // for is checked against what the scrollback still holds. lost is set
+    // to the bytes the client cannot get any more. True if the page has to
+    // be told its offset, because the replay starts or skipped output.
+    bool resume(int slot, const WebSerialScrollback & scrollback, uint64_t & lost) {
+      lost = 0;
+      if(_clients[slot].state == CLIENT_REQUESTED) {
+        uint64_t offset = _clients[slot].offset;
+        // no offset, or one from before a reboot
+        if(offset == WEBSERIAL_OFFSET_NONE || offset > scrollback.end())
+          offset = scrollback.start();
+        if(offset < scrollback.start()) {
+          lost = scrollback.start() - offset;
+          offset = scrollback.start();
+        }
+        _clients[slot].offset = offset == scrollback.start() ? scrollback.align(offset) : offset;
+        _clients[slot].state = CLIENT_REPLAYING;
+        return true;
+      }
+      if(_clients[slot].offset < scrollback.start()) {
+        // overwritten while the client was catching up
+        lost = scrollback.start() - _clients[slot].offset;
+        _clients[slot].offset = scrollback.align(scrollback.start());
+        return true;
+      }
+      return false;
+    }
+
+    // replayed up to, for a client that is not live
+    uint64_t offset(int slot) const { return _clients[slot].offset; }
+
+    void replayed(int slot, size_t len, const WebSerialScrollback & scrollback) {
+      _clients[slot].offset += len;
+      if(_clients[slot].offset >= scrollback.end())
+        _clients[slot].state = CLIENT_LIVE;
+    }
+
+    int slot(uint32_t id) const {
+      for(int i = 0; i < WEBSERIAL_MAX_CLIENTS; i++)
+        if(id && _clients[i].id == id)
+          return i;
+      return -1;
+    }
+
+    // input bytes of the client taken so far, it wraps like the page's count
+    uint32_t ack(int slot, size_t len) {
+      _clients[slot].acked += len;
+      return _clients[slot].acked;
+    }
+
+    // whether the client in slot gets a frame of len bytes; if so and it
+    // missed data before, notice holds a line to send ahead of the frame
+    bool admit(int slot, bool queueFull, size_t len, char * notice, size_t & noticeLen) {
+      noticeLen = 0;
+      if(queueFull) {
+        _clients[slot].dropped += len;
+        _dropped += len;
+        return false;
+      }
+      if(_clients[slot].dropped) {
+        noticeLen = snprintf(notice, WEBSERIAL_NOTICE_SIZE, "\n[%lu bytes dropped]\n", (unsigned long)_clients[slot].dropped);
+        _clients[slot].dropped = 0;
+      }
+      return true;
+    }
+
+    uint32_t dropped() const { return _dropped; } // all clients, since boot
+
+  private:
+    struct {
+      uint32_t id; // 0 for a free slot
+      uint32_t dropped;
+      uint32_t acked;
+      uint64_t offset; // requested, then replayed up to
+      uint8_t state;
+    } _clients[WEBSERIAL_MAX_CLIENTS];
+
+    enum { CLIENT_REQUESTED, CLIENT_REPLAYING, CLIENT_LIVE };
+    uint32_t _dropped;
+};
+
+#endif
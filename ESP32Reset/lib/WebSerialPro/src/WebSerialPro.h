@@ -18,6 +18,7 @@
 #endif
 
 #include "webserial_webpage.h"
+#include "WebSerialBuffer.h"
 
 #define DEBUG_ENABLED 0
 
@@ -28,8 +29,11 @@
 #endif
 
 #define WEBSERIAL_PRINTF_BUFFER_SIZE 512
+#define WEBSERIAL_CLIENT_EVENTS (2 * WEBSERIAL_MAX_CLIENTS) // connects and disconnects waiting for iterate()
 
 typedef std::function<void(uint8_t * data, size_t len)> RecvMsgHandler;
+// input as it arrives, last marks the end of a message; answer with ack()
+typedef std::function<void(uint32_t client, const uint8_t * data, size_t len, bool last)> RecvInputHandler;
 
 class WebSerialProClass {
   public:
@@ -56,6 +60,16 @@ class WebSerialProClass {
       _server = server;
       _ws = new AsyncWebSocket("/webserialws");
 
+      #if defined(ESP32)
+        char * scrollback = (char *)(psramFound() ? ps_malloc(WEBSERIAL_SCROLLBACK_SIZE) : malloc(WEBSERIAL_SCROLLBACK_SIZE));
+      #else
+        char * scrollback = (char *)malloc(WEBSERIAL_SCROLLBACK_SIZE);
+      #endif
+      _scrollback.begin(scrollback, WEBSERIAL_SCROLLBACK_SIZE);
+      #if defined(ESP32)
+        _clientEvents = xQueueCreate(WEBSERIAL_CLIENT_EVENTS, sizeof(ClientEvent));
+      #endif
+
       _server->on(url, HTTP_GET, [](AsyncWebServerRequest * request) {
         // Send Webpage
         AsyncWebServerResponse * response = request->beginResponse_P(200, "text/html", WEBSERIAL_HTML, sizeof(WEBSERIAL_HTML));
@@ -70,11 +84,24 @@ class WebSerialProClass {
       _ws->onEvent([ & ](AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t * data, size_t len) -> void {
         if (type == WS_EVT_CONNECT) {
           DEBUG_WEBSERIAL("Client connection received");
+          // /webserialws?offset=N resumes after the output the page already has
+          AsyncWebServerRequest * request = (AsyncWebServerRequest *)arg;
+          uint64_t offset = WEBSERIAL_OFFSET_NONE;
+          if (request && request->hasParam("offset"))
+            offset = strtoull(request->getParam("offset")->value().c_str(), NULL, 10);
+          // no slot without its event, the page reconnects later
+          if (!_queueClientEvent(client->id(), offset, true))
+            client->close();
         } else if (type == WS_EVT_DISCONNECT) {
           DEBUG_WEBSERIAL("Client disconnected");
+          // if this is lost, the slot is freed once the client is gone
+          _queueClientEvent(client->id(), 0, false);
         } else if (type == WS_EVT_DATA) {
           DEBUG_WEBSERIAL("Received Websocket Data");
-          if (_RecvFunc != NULL) {
+          AwsFrameInfo * info = (AwsFrameInfo *)arg;
+          if (_InputFunc != NULL) {
+            _InputFunc(client->id(), data, len, info->final && info->index + len == info->len);
+          } else if (_RecvFunc != NULL) {
             _RecvFunc(data, len);
           }
         }
@@ -88,97 +115,249 @@ class WebSerialProClass {
       _RecvFunc = _recv;
     }
 
-    // Print
+    void inputCallback(RecvInputHandler _input) {
+      _InputFunc = _input;
+    }
 
-    void print(String m = "") {
-      _ws->textAll(m);
+    // len more bytes of the client's input were taken; the page sends no
+    // more than WEBSERIAL_INPUT_WINDOW bytes ahead of the count it got as a
+    // 4 byte little-endian binary frame
+    void ack(uint32_t id, size_t len, bool dropped = false) {
+      _takeClientEvents();
+      int slot = _clients.slot(id);
+      if(!_ws || slot < 0)
+        return;
+      uint32_t acked = _clients.ack(slot, len);
+      AsyncWebSocketClient * client = _ws->client(id);
+      if(!client || client->status() != WS_CONNECTED)
+        return;
+      if(dropped) {
+        char notice[WEBSERIAL_NOTICE_SIZE];
+        client->text(notice, snprintf(notice, sizeof(notice), "\n[%lu bytes of input dropped]\n", (unsigned long)len));
+        _sendOffset(client, slot);
+      }
+      _sendValue(client, WEBSERIAL_FRAME_ACK, acked, 4);
     }
 
-    void print(const char * m) {
-      _ws->textAll(m);
+    // Print; output is collected and sent as one frame once
+    // WEBSERIAL_FRAME_SIZE bytes are pending or WEBSERIAL_FLUSH_MS passed,
+    // call iterate() regularly for the latter
+
+    void write(const uint8_t * data, size_t len) {
+      _out.write((const char *)data, len, millis());
     }
 
-    void print(char * m) {
-      _ws->textAll(m);
+    void print(const String & m = "") {
+      _out.write(m.c_str(), m.length(), millis());
+    }
+
+    void print(const char * m) {
+      _out.write(m, strlen(m), millis());
     }
 
     void print(int m) {
-      _ws->textAll(String(m));
+      _out.writeNumber((long)m, millis());
     }
 
     void print(uint8_t m) {
-      _ws->textAll(String(m));
+      _out.writeNumber((unsigned long)m, millis());
     }
 
     void print(uint16_t m) {
-      _ws->textAll(String(m));
+      _out.writeNumber((unsigned long)m, millis());
     }
 
     void print(uint32_t m) {
-      _ws->textAll(String(m));
+      _out.writeNumber((unsigned long)m, millis());
     }
 
     void print(double m) {
-      _ws->textAll(String(m));
+      _out.writeNumber(m, millis());
     }
 
     void print(float m) {
-      _ws->textAll(String(m));
+      _out.writeNumber((double)m, millis());
     }
 
     // Print with New Line
 
-    void println(String m = "") {
-      _ws->textAll(m + "\n");
+    template <typename T>
+    void println(T m) {
+      print(m);
+      _out.write("\n", 1, millis());
     }
 
-    void println(const char * m) {
-      _ws->textAll(String(m) + "\n");
+    void println(const String & m = "") {
+      print(m);
+      _out.write("\n", 1, millis());
     }
 
-    void println(char * m) {
-      _ws->textAll(String(m) + "\n");
+    void printf(const char* format, ...){
+      va_list args;
+      va_start(args, format);
+      char payload[WEBSERIAL_PRINTF_BUFFER_SIZE];
+      int len = vsnprintf(payload, WEBSERIAL_PRINTF_BUFFER_SIZE, format, args);
+      va_end(args);
+      if(len > 0)
+        _out.write(payload, len < WEBSERIAL_PRINTF_BUFFER_SIZE ? len : WEBSERIAL_PRINTF_BUFFER_SIZE - 1, millis());
     }
 
-    void println(int m) {
-      _ws->textAll(String(m) + "\n");
+    // also replays scrollback to new clients, call it from the task that
+    // prints so offsets and frames stay in order
+    void iterate() {
+      _takeClientEvents();
+      _out.iterate(millis());
+      _replay();
     }
 
-    void println(uint8_t m) {
-      _ws->textAll(String(m) + "\n");
+    void flush() {
+      _out.flush();
     }
 
-    void println(uint16_t m) {
-      _ws->textAll(String(m) + "\n");
-    }
+    uint32_t frames() const { return _out.frames(); }
+    uint32_t bytes() const { return _out.bytes(); }
+    uint32_t dropped() const { return _clients.dropped(); }
+
+  private:
+    AsyncWebServer * _server;
+    AsyncWebSocket * _ws = NULL;
+
+    String identity = "";
 
-    void println(uint32_t m) {
-      _ws->textAll(String(m) + "\n");
+    RecvMsgHandler _RecvFunc = NULL;
+    RecvInputHandler _InputFunc = NULL;
+
+    WebSerialBuffer _out{sendFrame, this};
+    WebSerialClients _clients;
+    WebSerialScrollback _scrollback;
+
+    typedef struct {
+      uint32_t id;
+      uint64_t offset;
+      bool connected;
+    } ClientEvent;
+    #if defined(ESP32)
+      QueueHandle_t _clientEvents = NULL;
+    #endif
+
+    // the client slots belong to the task that calls iterate() and ack(),
+    // the AsyncTCP task only queues connects and disconnects for it
+    bool _queueClientEvent(uint32_t id, uint64_t offset, bool connected) {
+      #if defined(ESP32)
+        ClientEvent event = { id, offset, connected };
+        return _clientEvents && xQueueSend(_clientEvents, &event, 0) == pdTRUE;
+      #else
+        if(connected)
+          _clients.add(id, offset);
+        else
+          _clients.remove(id);
+        return true;
+      #endif
     }
 
-    void println(float m) {
-      _ws->textAll(String(m) + "\n");
+    void _takeClientEvents() {
+      #if defined(ESP32)
+        ClientEvent event;
+        while(_clientEvents && xQueueReceive(_clientEvents, &event, 0) == pdTRUE) {
+          if(event.connected)
+            _clients.add(event.id, event.offset);
+          else
+            _clients.remove(event.id);
+        }
+      #endif
     }
 
-    void println(double m) {
-      _ws->textAll(String(m) + "\n");
+    static void sendFrame(void * arg, const char * data, size_t len) {
+      ((WebSerialProClass *)arg)->_sendFrame(data, len);
     }
 
-    void printf(const char* format, ...){
-      va_list args;
-      va_start(args, format);
-      char payload[WEBSERIAL_PRINTF_BUFFER_SIZE];
-      uint16_t len = vsnprintf(payload, WEBSERIAL_PRINTF_BUFFER_SIZE, format, args);
-      _ws->textAll(payload, len);
+    void _sendValue(AsyncWebSocketClient * client, uint8_t type, uint64_t value, size_t size) {
+      uint8_t frame[9] = { type };
+      for(size_t i = 0; i < size; i++)
+        frame[1 + i] = (uint8_t)(value >> (8 * i));
+      client->binary(frame, 1 + size);
     }
 
-  private:
-    AsyncWebServer * _server;
-    AsyncWebSocket * _ws;
+    // after a notice, so the page can keep counting where it is
+    void _sendOffset(AsyncWebSocketClient * client, int slot) {
+      _sendValue(client, WEBSERIAL_FRAME_OFFSET, _clients.live(slot) ? _scrollback.end() : _clients.offset(slot), 8);
+    }
 
-    String identity = "";
+    // scrollback to one new client at a time, as much as its queue takes
+    void _replay() {
+      int slot = _clients.replaying();
+      if(!_ws || slot < 0)
+        return;
+      AsyncWebSocketClient * client = _ws->client(_clients.id(slot));
+      if(!client) {
+        // its disconnect was not queued
+        _clients.remove(_clients.id(slot));
+        return;
+      }
+      if(client->status() != WS_CONNECTED)
+        return;
+      uint64_t lost;
+      if(_clients.resume(slot, _scrollback, lost)) {
+        if(lost) {
+          char notice[WEBSERIAL_NOTICE_SIZE];
+          client->text(notice, snprintf(notice, sizeof(notice), "\n[%llu bytes of scrollback lost]\n", (unsigned long long)lost));
+        }
+        _sendOffset(client, slot);
+      }
+      uint64_t offset = _clients.offset(slot);
+      while(offset < _scrollback.end() && !client->queueIsFull()) {
+        size_t len = _scrollback.frame(offset, WEBSERIAL_REPLAY_FRAME);
+        AsyncWebSocketMessageBuffer * buffer = _ws->makeBuffer(len);
+        if(!buffer)
+          return;
+        _scrollback.read(offset, (char *)buffer->get(), len);
+        client->text(buffer);
+        _clients.replayed(slot, len, _scrollback);
+        offset += len;
+      }
+      if(offset >= _scrollback.end())
+        _clients.replayed(slot, 0, _scrollback);
+    }
 
-    RecvMsgHandler _RecvFunc = NULL;
+    // one buffer shared by all clients that keep up; clients catching up
+    // get the frame with the scrollback instead
+    void _sendFrame(const char * data, size_t len) {
+      uint64_t offset = _scrollback.end();
+      _scrollback.write(data, len);
+      if(!_ws)
+        return;
+      AsyncWebSocketMessageBuffer * buffer = NULL;
+      for(int i = 0; i < WEBSERIAL_MAX_CLIENTS; i++) {
+        if(!_clients.id(i) || !_clients.live(i))
+          continue;
+        AsyncWebSocketClient * client = _ws->client(_clients.id(i));
+        if(!client) {
+          _clients.remove(_clients.id(i));
+          continue;
+        }
+        if(client->status() != WS_CONNECTED)
+          continue;
+        char notice[WEBSERIAL_NOTICE_SIZE];
+        size_t noticeLen;
+        if(!_clients.admit(i, client->queueIsFull(), len, notice, noticeLen))
+          continue;
+        if(noticeLen) {
+          client->text(notice, noticeLen);
+          _sendValue(client, WEBSERIAL_FRAME_OFFSET, offset, 8);
+        }
+        if(!buffer) {
+          buffer = _ws->makeBuffer((uint8_t *)data, len);
+          if(!buffer)
+            return;
+          buffer->lock();
+        }
+        client->text(buffer);
+      }
+      if(buffer) {
+        buffer->unlock();
+        _ws->_cleanBuffers();
+      }
+    }
 };
 
 WebSerialProClass WebSerialPro;
@@ -2,376 +2,347 @@
 #ifndef _webserial_webapge_h
 #define _webserial_webpage_h
 
-const uint32_t WEBSERIAL_HTML_SIZE = 11023;
+const uint32_t WEBSERIAL_HTML_SIZE = 12189;
 const uint8_t WEBSERIAL_HTML[] PROGMEM = { 
-31,139,8,0,0,0,0,0,2,3,196,90,121,119,164,56,14,255,123,231,83,48,153,215,47,157,25,32,212,153,
-10,149,100,239,251,190,239,195,5,166,240,182,193,44,152,84,101,120,124,247,245,69,129,40,226,74,239,217,157,4,
-44,253,36,100,75,22,72,240,240,233,183,126,250,205,95,253,254,103,223,118,82,158,209,167,79,30,228,193,161,40,
-223,63,94,225,252,74,18,48,138,159,62,249,202,67,134,57,114,162,20,149,21,230,143,215,53,79,188,205,245,137,
-158,163,12,63,94,63,19,124,40,88,201,175,157,136,229,28,231,2,119,32,49,79,31,99,252,76,34,236,169,129,
-75,114,194,9,162,94,21,33,138,31,103,66,137,208,194,9,167,248,233,183,120,247,75,92,10,166,243,179,146,61,
-220,106,162,224,86,252,69,158,56,226,223,231,238,231,33,74,56,46,197,113,135,19,86,226,102,199,142,94,69,190,
-36,249,62,36,121,42,228,121,43,103,49,164,239,88,25,227,210,19,148,109,34,76,147,100,28,174,231,254,234,93,
-187,99,241,75,19,49,202,202,240,179,85,176,94,223,7,26,146,160,140,208,151,240,250,23,108,199,56,187,118,157,
-235,239,97,250,140,57,137,144,243,19,92,99,64,145,131,175,75,195,197,73,133,242,202,171,132,25,201,224,90,51,
-127,141,51,61,62,96,178,79,121,184,8,130,45,197,156,11,179,170,2,69,210,74,63,152,9,16,37,57,246,82,
-13,18,98,237,142,178,232,195,63,106,198,113,99,166,65,113,194,195,192,95,148,56,115,42,70,73,236,124,150,204,
-146,101,178,217,102,168,220,147,220,0,186,81,41,85,137,97,129,226,88,94,102,38,229,102,254,74,28,6,202,157,
-207,67,138,42,238,69,41,161,113,99,68,197,212,57,203,194,160,245,119,181,56,203,93,115,32,121,81,243,63,242,
-151,66,120,93,147,174,255,12,136,37,174,48,31,209,170,122,151,17,65,108,118,40,250,176,47,89,157,199,158,89,
-248,249,230,91,235,111,220,111,245,252,196,212,102,253,212,32,207,43,81,76,234,42,244,151,2,177,53,210,73,146,
-108,163,186,172,196,121,193,72,206,113,185,141,73,85,80,244,34,2,66,45,167,154,38,112,199,172,28,249,227,78,
-248,35,53,174,241,55,130,59,246,142,22,81,234,32,174,91,215,192,89,248,129,36,112,124,228,30,162,100,159,135,
-17,150,230,104,74,140,35,86,34,78,88,30,230,44,199,154,200,75,17,46,34,140,179,176,46,10,92,70,168,194,
-219,67,74,56,86,215,197,2,121,40,81,209,173,127,152,176,168,174,220,110,148,178,103,92,186,128,5,56,83,110,
-50,184,41,22,144,2,126,132,66,128,3,100,128,159,129,16,96,25,41,16,8,96,7,26,103,67,226,192,219,172,
-230,210,17,125,96,254,81,56,28,237,40,142,255,236,142,9,147,83,133,236,241,164,32,23,90,15,216,141,9,187,
-24,39,168,166,124,203,100,172,240,151,208,95,157,27,6,125,55,160,27,47,78,195,167,209,246,57,25,89,59,200,
-226,237,177,34,43,198,18,1,22,69,0,4,53,93,74,15,144,216,173,179,57,120,38,50,220,105,234,212,138,216,
-48,102,178,54,136,153,198,24,115,62,11,181,211,11,84,226,156,111,223,50,5,24,47,99,166,9,26,139,160,77,
-206,178,14,80,203,91,144,175,7,146,85,165,5,104,9,41,171,74,11,210,232,180,186,197,150,118,204,232,21,95,
-77,239,114,27,12,250,207,170,236,34,202,238,83,139,230,143,147,177,251,217,126,153,183,139,188,221,247,151,179,203,
-229,235,52,192,229,230,241,209,190,61,35,138,81,233,78,209,108,171,9,17,112,33,32,0,78,97,140,120,123,0,
-3,198,229,25,193,192,133,172,137,96,5,66,211,50,246,160,132,26,46,227,236,193,7,213,93,134,217,131,204,162,
-14,226,160,190,127,207,55,48,193,0,245,103,145,110,7,65,127,89,21,89,49,86,31,90,180,126,140,132,197,175,
-214,75,188,93,224,173,190,126,75,58,177,95,163,129,187,44,98,241,240,49,32,52,69,218,100,37,211,151,38,155,
-245,59,83,184,133,129,227,207,135,5,134,26,57,170,112,155,170,17,138,210,114,57,80,52,194,202,74,154,158,80,
-118,240,94,194,148,196,49,206,165,166,39,109,61,48,53,56,149,85,186,158,154,40,40,129,93,66,77,155,150,70,
-137,144,54,218,56,43,96,137,7,171,215,80,87,81,78,208,14,29,160,150,118,84,80,198,136,227,9,18,39,217,
-107,100,79,216,141,232,136,137,51,68,198,180,76,248,35,29,209,242,58,219,225,177,13,5,170,170,131,152,215,136,
-92,97,84,70,99,5,28,211,51,202,145,143,72,117,57,6,29,48,254,208,145,132,175,249,123,69,255,243,141,43,
-165,81,137,145,91,97,138,35,222,120,7,188,251,64,184,135,138,66,92,30,229,17,214,133,230,27,210,18,116,136,
-45,82,85,87,37,69,49,59,24,229,103,221,151,237,116,121,236,175,117,152,4,42,136,239,36,75,53,132,194,89,
-16,188,155,240,53,216,134,192,227,144,1,253,110,152,22,239,3,8,136,1,192,1,145,0,57,48,30,32,11,70,
-5,96,194,216,0,44,16,33,147,244,35,159,100,212,37,16,0,49,3,24,32,114,12,189,139,31,51,212,81,164,
-7,205,84,173,53,40,187,53,118,152,110,132,37,239,229,74,163,144,100,104,143,111,171,231,253,23,199,140,110,107,
-158,108,220,7,49,114,196,40,175,30,175,82,206,139,240,246,246,112,56,248,135,133,207,202,253,237,60,8,2,137,
-191,114,100,7,241,27,236,248,120,21,56,129,179,8,156,205,149,163,59,136,87,139,224,234,233,161,64,60,117,18,
-66,233,227,213,187,249,66,5,169,64,196,143,87,63,14,220,128,174,221,13,93,123,155,171,219,167,7,169,237,233,
-250,198,209,237,23,71,117,192,156,156,121,37,46,48,226,93,72,122,138,110,242,77,11,167,223,111,25,53,157,255,
-195,244,244,154,219,166,103,76,254,99,86,83,78,10,138,135,157,53,189,57,205,78,68,53,103,109,231,237,38,35,
-185,103,24,107,221,5,164,104,135,169,75,241,30,231,113,3,115,60,104,97,78,245,204,96,167,80,235,75,8,166,
-113,133,121,23,69,106,146,131,14,228,40,181,167,56,250,32,210,200,40,237,201,172,195,68,183,16,182,242,90,95,
-25,235,233,81,51,213,231,3,38,230,172,204,16,5,141,81,109,163,31,9,20,18,66,101,115,186,221,202,117,18,
-208,163,49,120,54,155,251,1,236,240,117,4,86,17,213,200,43,49,69,156,60,227,97,42,243,75,118,56,25,150,
-80,124,220,202,63,94,76,74,28,41,161,136,209,58,203,123,173,99,97,249,235,137,104,53,128,230,4,156,226,62,
-249,90,221,20,74,62,22,52,242,226,234,44,148,127,122,38,103,69,163,154,148,30,225,56,171,66,133,171,56,42,
-121,143,209,94,61,135,137,56,233,65,122,147,1,144,38,245,144,138,151,152,71,41,192,24,218,224,98,168,194,210,
-139,0,213,17,21,204,233,230,10,99,84,154,20,206,156,89,231,63,216,3,63,122,253,242,194,149,238,21,154,131,
-199,146,164,194,220,155,5,205,80,203,204,142,158,67,244,252,2,122,5,209,43,43,122,177,112,109,220,37,208,181,
-88,248,11,241,207,170,112,9,141,93,218,141,93,65,244,202,142,94,67,244,250,2,122,237,218,184,119,80,215,218,
-95,139,127,86,133,119,112,101,239,236,43,187,129,198,110,236,198,222,67,244,253,52,90,6,142,10,70,153,223,69,
-212,128,232,155,150,152,15,36,230,64,98,254,154,196,106,32,177,2,18,211,51,126,45,136,22,203,94,145,9,157,
-129,54,123,52,45,7,102,47,129,217,175,69,212,106,32,177,2,18,175,69,213,122,32,177,6,18,175,69,214,116,
-72,137,88,234,21,153,64,2,218,108,177,117,55,88,237,59,176,218,175,197,215,102,96,246,6,152,253,90,140,221,
-15,36,238,129,196,56,206,186,227,32,121,87,152,38,32,119,79,192,97,30,151,18,48,141,143,241,32,165,107,188,
-201,232,95,203,112,76,208,251,140,228,198,66,225,253,18,103,55,141,84,211,140,238,115,130,4,178,177,167,31,254,
-77,18,142,16,141,222,203,76,236,124,97,110,171,55,192,24,248,14,178,43,46,6,247,98,173,173,109,17,172,187,
-39,95,182,181,221,67,46,50,165,58,108,186,196,212,101,212,173,105,67,73,197,61,245,186,89,137,25,243,117,201,
-218,93,90,79,70,10,57,66,78,252,101,234,111,45,117,72,10,83,20,166,40,181,162,212,138,82,75,74,211,63,
-80,9,231,26,253,161,46,158,133,251,205,137,121,36,101,192,32,49,37,146,33,234,144,188,34,49,110,161,181,17,
-41,35,138,13,111,252,186,54,142,221,152,187,148,140,150,212,44,96,247,180,166,159,190,76,25,112,42,14,198,50,
-227,247,198,174,152,95,66,246,117,137,93,249,26,83,174,99,225,22,98,196,101,107,68,174,41,84,48,215,10,36,
-215,244,23,250,87,172,163,6,67,223,153,56,170,71,216,225,139,85,233,131,225,221,156,199,46,79,141,190,238,82,
-176,166,221,172,239,209,110,211,55,45,116,55,197,204,135,199,97,66,74,243,250,91,170,26,14,27,232,120,9,166,
-104,136,237,71,13,44,45,130,215,55,140,94,128,110,190,106,52,156,175,249,74,162,109,119,110,197,75,150,239,155,
-225,83,237,142,209,184,45,154,97,116,182,233,204,77,231,110,186,112,211,165,155,174,220,116,221,92,248,220,192,211,
-111,180,199,238,9,52,17,104,30,68,237,82,151,1,240,43,133,121,155,206,7,152,197,36,102,213,166,139,1,104,
-238,111,206,65,139,54,93,2,140,116,210,185,225,193,148,168,208,191,234,101,5,101,51,45,187,58,151,21,162,107,
-32,186,158,16,13,70,66,203,150,100,251,6,62,96,182,190,234,12,38,228,168,191,82,105,212,80,248,139,167,91,
-243,81,76,120,237,92,111,129,223,91,95,56,29,113,21,94,141,58,85,225,109,200,58,148,12,93,158,11,134,218,
-8,89,205,113,108,18,153,137,110,231,83,146,21,172,228,40,231,131,2,199,59,118,155,48,92,202,152,87,229,160,
-159,9,158,103,82,109,127,195,2,183,56,49,178,100,124,168,160,191,71,14,140,24,232,130,140,118,66,239,218,166,
-119,21,188,162,23,50,218,214,255,123,93,113,146,188,120,102,185,187,123,217,136,28,106,178,89,74,131,57,251,112,
-67,215,169,141,236,151,153,130,79,103,24,199,159,173,42,71,134,3,50,152,48,20,254,140,112,202,168,96,67,167,
-136,165,102,57,225,172,244,250,146,243,172,128,60,129,154,81,7,85,149,110,93,33,63,15,130,226,56,72,123,163,
-205,171,246,115,137,85,12,139,84,194,73,132,232,121,247,111,212,221,211,218,132,222,222,206,154,19,42,204,195,85,
-111,39,218,85,194,35,28,111,101,74,152,75,43,116,134,91,202,211,83,227,49,39,25,82,240,4,197,248,251,249,
-183,216,33,119,252,211,74,109,189,140,125,121,17,116,129,127,10,28,116,28,5,228,132,249,210,216,89,111,172,60,
-109,205,22,245,244,189,113,176,235,3,157,48,6,61,19,176,225,77,190,250,168,111,86,224,181,84,11,110,120,99,
-185,105,96,95,66,55,38,228,173,239,127,98,29,184,212,199,27,231,136,46,84,35,219,85,97,84,151,178,151,252,
-77,169,124,219,5,158,217,72,85,189,59,61,56,73,119,44,139,163,197,133,211,79,145,253,6,7,207,183,19,54,
-195,91,181,121,192,241,35,84,198,29,71,16,213,84,28,115,132,201,163,16,211,241,164,17,227,124,169,89,39,37,
-70,214,191,147,7,248,97,217,164,27,166,191,98,155,175,68,104,246,25,112,45,35,245,44,7,13,190,123,50,51,
-25,180,224,3,39,240,205,108,212,161,220,239,208,251,249,220,117,230,27,215,89,174,92,193,158,221,244,83,236,219,
-253,246,78,255,74,207,171,155,237,92,170,158,235,57,131,22,10,101,123,214,45,213,172,91,42,231,180,104,219,186,
-18,74,77,99,85,62,79,75,9,36,46,116,182,188,206,188,59,235,32,42,186,70,177,148,145,56,166,120,34,221,
-84,5,201,157,89,159,36,28,146,39,242,9,10,195,148,99,3,94,198,156,172,247,164,143,198,143,181,42,208,204,
-174,53,125,114,53,229,97,193,34,151,111,120,47,129,81,2,238,42,174,51,113,167,49,250,253,164,166,84,199,76,
-51,244,134,225,74,35,197,5,213,2,254,223,150,234,107,74,219,7,252,146,148,40,195,149,35,145,141,52,179,145,
-140,193,103,143,37,227,136,227,247,139,117,16,227,253,77,43,4,141,201,147,178,134,103,17,255,87,196,182,111,210,
-215,223,142,26,161,179,251,212,47,24,8,171,51,42,228,127,255,222,19,91,251,166,157,5,3,228,108,26,25,136,
-171,200,79,160,111,205,87,206,15,183,250,147,235,7,249,101,178,56,196,228,217,33,241,227,21,42,138,43,209,250,
-23,67,65,172,162,146,20,252,233,147,127,50,111,37,204,141,226,202,255,171,16,106,255,172,168,109,243,55,56,215,
-56,163,77,57,174,108,237,206,157,57,82,147,202,206,225,96,197,246,91,27,28,192,206,233,239,254,126,45,129,5,
-227,204,187,175,114,10,53,173,86,75,234,83,52,100,9,153,163,67,94,46,18,29,45,133,127,239,46,114,229,228,
-69,54,137,11,247,160,194,59,5,122,86,235,187,68,20,254,125,166,138,69,166,123,108,135,18,107,252,235,139,63,
-193,109,131,56,83,44,144,4,38,87,163,75,153,65,17,96,47,199,131,120,44,146,90,87,102,121,187,21,210,149,
-146,139,250,233,165,83,88,194,88,20,148,216,101,108,201,226,48,145,50,233,2,146,201,195,67,225,121,110,170,215,
-80,27,253,240,240,151,121,78,13,207,34,128,80,84,50,236,115,82,104,172,110,194,4,164,152,100,146,32,58,21,
-71,250,35,114,1,220,195,195,55,155,204,205,38,205,139,210,87,233,80,5,112,224,116,169,12,215,162,70,185,168,
-201,115,136,58,195,76,37,149,228,142,167,138,239,26,228,189,191,74,254,234,157,248,75,111,146,168,206,109,240,125,
-110,239,213,141,94,120,99,246,161,213,241,64,184,142,91,235,186,52,210,161,212,170,37,64,248,58,94,130,229,11,
-20,27,84,162,50,97,8,72,248,242,231,162,148,200,99,4,150,235,117,37,115,150,175,148,234,176,26,214,43,96,
-166,136,90,16,191,223,45,130,145,42,234,152,45,144,122,94,17,228,13,52,169,26,231,121,165,238,229,96,186,80,
-210,240,79,14,93,183,155,172,166,170,112,102,214,1,198,44,165,153,172,217,202,136,49,162,230,57,147,75,177,53,
-243,139,49,159,48,18,117,237,28,103,89,154,9,247,151,106,0,18,209,84,13,29,68,119,46,178,56,113,138,172,
-154,96,227,78,249,176,62,185,27,104,195,244,15,74,225,205,86,190,240,131,31,126,8,210,228,203,12,113,30,182,
-180,200,199,172,140,56,77,242,194,89,202,243,79,212,231,203,41,95,206,248,114,33,223,100,233,108,146,179,177,33,
-71,47,225,145,7,188,149,91,185,21,218,221,92,241,218,79,215,236,152,224,57,19,24,190,55,146,151,255,78,21,
-118,192,135,114,127,207,253,123,16,162,208,146,222,195,238,5,15,44,36,98,216,211,101,48,85,201,8,143,169,197,
-79,50,244,239,13,163,68,46,207,139,79,7,236,224,116,36,18,108,197,95,241,176,177,137,7,84,13,2,135,126,
-53,222,239,7,243,116,46,124,172,187,57,195,233,227,51,156,242,12,55,193,120,144,99,150,135,7,113,195,22,199,
-19,66,37,254,234,116,61,195,234,26,110,167,68,53,165,225,126,112,182,158,246,108,61,45,139,138,88,28,116,99,
-206,223,136,112,86,237,71,162,208,162,224,29,192,196,138,0,225,125,196,62,195,118,180,152,15,57,218,249,132,0,
-23,152,255,47,249,98,112,126,41,219,4,35,112,56,45,110,15,202,86,158,183,194,79,100,217,120,158,133,131,57,
-216,196,197,13,140,20,20,186,34,80,178,91,135,206,43,172,205,112,126,185,169,181,143,198,190,91,161,196,66,33,
-125,51,227,121,251,147,231,137,101,165,125,186,133,212,176,231,54,93,4,197,88,37,226,131,239,147,165,14,248,136,
-46,218,13,220,121,242,255,157,240,161,253,233,65,134,79,159,38,255,215,9,173,120,142,69,76,83,154,208,130,122,
-52,160,161,222,93,165,172,75,57,131,45,196,149,40,174,229,52,152,103,233,60,127,120,184,95,209,92,198,224,47,
-239,171,189,119,89,192,132,205,27,64,19,118,7,100,182,223,197,190,210,226,139,186,90,12,166,221,30,93,232,87,
-214,44,247,202,83,186,112,5,192,67,197,213,175,91,190,107,104,131,17,86,156,230,30,139,226,131,89,151,165,248,
-114,48,23,151,135,151,188,225,18,13,10,159,216,131,249,212,149,235,185,180,40,186,67,202,255,152,204,191,152,37,
-108,133,43,237,109,35,118,38,24,201,156,181,39,39,135,19,72,229,154,132,14,100,65,16,40,196,190,82,38,169,
-84,165,9,30,42,40,166,155,84,206,175,135,122,94,207,240,128,145,83,5,200,212,135,254,182,230,129,157,216,243,
-230,129,6,208,93,135,5,2,237,200,243,62,98,250,2,26,76,86,190,207,91,157,91,67,29,177,226,83,76,210,
-180,86,144,84,138,144,91,91,11,207,91,152,117,248,52,13,10,156,92,149,113,130,105,48,190,29,102,24,80,169,
-184,176,71,9,155,85,122,89,54,128,29,33,46,177,57,115,246,227,164,146,251,43,177,102,118,48,175,57,128,133,
-131,41,27,168,61,40,96,140,154,226,124,242,29,234,152,131,29,18,51,116,14,9,137,165,54,169,117,55,164,182,
-12,38,232,120,25,12,21,180,132,96,224,19,48,162,239,67,54,118,221,164,40,46,247,99,173,113,106,77,107,82,
-183,172,188,105,71,139,149,118,180,131,169,231,77,131,153,96,78,116,37,132,176,10,87,114,18,204,96,94,137,207,
-158,133,161,34,243,15,242,195,220,184,163,54,142,110,42,84,233,110,213,164,8,237,208,29,45,234,126,47,226,181,
-50,0,12,146,120,156,102,62,33,82,175,248,88,183,164,62,156,237,178,150,237,238,88,37,108,157,156,96,51,138,
-225,161,51,26,211,136,64,74,167,116,70,23,116,75,87,244,156,110,232,3,29,209,75,250,72,199,116,39,11,152,
-101,48,25,66,8,56,133,254,228,186,116,34,183,138,243,8,118,246,10,12,75,115,189,135,232,239,19,185,16,46,
-14,152,174,79,202,130,153,5,99,11,246,44,56,99,80,87,193,112,51,150,67,182,74,219,187,100,208,60,154,224,
-174,47,113,230,120,167,146,33,224,83,77,122,102,73,47,44,120,226,121,39,108,14,116,171,137,174,184,167,122,37,
-129,238,231,26,123,99,233,63,88,240,136,65,212,207,120,186,151,152,238,206,167,107,49,35,119,50,116,201,197,65,
-62,31,140,212,111,102,181,166,131,143,145,232,98,246,21,170,86,204,67,207,177,254,138,104,172,50,181,30,50,184,
-152,36,67,117,131,206,80,227,122,228,198,120,13,144,3,97,106,19,26,187,180,216,178,102,98,31,221,12,65,131,
-85,196,226,10,170,175,74,161,184,240,19,104,70,223,178,118,214,111,130,53,143,216,246,227,228,2,212,149,101,225,
-86,144,11,194,43,75,88,150,202,244,248,139,13,254,27,245,74,77,119,214,156,135,81,153,69,113,101,194,177,117,
-105,221,173,54,57,219,218,174,166,72,26,60,157,199,107,183,154,242,200,82,114,37,70,227,62,108,240,199,2,26,
-163,110,154,252,171,242,14,206,188,52,19,41,229,8,130,104,18,0,52,229,179,37,55,240,45,110,224,96,220,192,
-203,184,129,171,33,166,66,245,198,155,216,124,76,239,216,52,35,110,224,137,220,192,29,13,131,83,211,156,113,3,
-239,44,173,122,6,137,115,74,100,44,60,214,52,87,204,253,202,112,47,197,239,227,238,201,39,129,30,94,227,115,
-202,13,112,99,22,11,31,231,6,142,206,13,188,221,167,143,56,7,28,203,243,75,172,178,116,71,112,216,69,218,
-211,24,60,200,162,98,148,48,110,143,113,198,56,39,241,31,140,233,104,204,85,109,220,254,39,255,19,125,68,114,
-129,168,202,99,118,232,37,158,55,51,103,109,156,156,172,36,60,239,91,201,68,76,42,190,177,101,159,56,236,28,
-158,160,231,36,24,138,16,242,144,90,16,221,147,195,147,192,76,210,21,39,146,195,18,25,239,103,105,177,140,124,
-210,147,111,136,200,160,239,176,26,177,25,232,144,47,106,73,33,225,248,230,186,63,37,8,204,215,112,109,253,112,
-132,129,188,208,34,224,79,251,100,130,152,252,146,238,176,227,161,64,70,84,158,199,103,82,163,181,161,40,245,97,
-84,167,251,158,151,237,141,207,146,10,41,21,199,254,170,118,212,60,17,137,9,216,170,30,101,85,45,202,66,94,
-112,175,95,223,191,124,33,127,212,79,250,218,90,229,134,187,88,167,223,193,151,130,13,202,166,223,53,59,97,234,
-77,132,41,96,1,247,55,125,177,104,63,79,140,92,199,20,154,13,220,248,144,49,218,198,159,235,232,242,133,116,
-117,65,216,169,87,132,171,47,27,249,67,198,48,162,40,138,119,130,237,40,164,54,133,237,214,54,106,141,79,24,
-8,219,227,86,20,183,105,59,232,116,246,90,120,131,184,219,161,253,214,62,237,231,173,125,115,139,118,63,198,8,
-16,236,82,137,97,146,211,168,191,171,185,128,55,1,218,71,19,70,78,31,215,61,61,81,217,203,88,92,239,184,
-138,194,11,50,223,81,150,37,21,115,117,126,79,126,47,170,223,55,130,116,106,197,191,166,80,31,137,61,63,247,
-83,40,22,86,144,140,44,255,230,245,199,70,128,252,139,225,15,193,202,24,240,4,141,2,0,151,236,22,52,212,
-245,9,54,64,213,48,187,87,155,231,132,129,125,166,152,55,203,46,236,51,92,212,87,195,195,215,221,95,204,83,
-179,4,13,103,242,217,95,62,31,216,172,174,2,222,124,223,44,91,186,125,126,232,114,41,211,73,58,110,80,142,
-181,91,219,157,219,204,88,127,83,210,200,107,150,196,190,124,216,200,30,27,239,126,254,82,136,71,147,153,38,230,
-21,205,48,149,241,234,30,34,232,128,35,168,170,197,198,29,29,27,227,26,102,155,99,99,175,17,27,103,28,130,
-140,224,248,112,63,230,248,86,138,16,141,198,196,162,49,153,143,193,86,131,9,247,177,184,122,38,144,12,26,26,
-253,165,166,209,166,66,122,194,101,71,101,133,0,100,179,174,50,47,82,62,252,109,143,246,79,247,224,53,17,94,
-85,236,225,26,109,119,90,59,252,123,183,71,219,124,71,123,180,183,236,252,186,27,183,194,32,108,119,8,164,132,
-119,77,79,64,76,209,18,14,71,37,158,113,20,241,111,28,70,113,137,164,168,85,118,180,162,101,107,223,193,76,
-186,167,85,178,224,223,175,79,176,2,198,239,238,108,131,89,103,123,183,213,161,78,171,147,119,204,29,225,110,25,
-254,26,238,221,57,47,195,125,56,233,180,29,180,219,17,237,255,186,11,150,191,134,251,119,149,178,117,192,114,233,
-47,69,172,146,82,199,45,80,134,187,21,198,132,175,6,170,140,98,192,217,48,86,250,90,106,124,45,1,96,172,
-166,169,172,134,114,94,255,163,202,137,32,219,232,49,137,141,91,225,191,67,105,206,99,90,59,13,35,200,253,9,
-253,117,21,117,88,145,255,227,186,120,182,206,184,148,82,102,131,94,188,25,244,98,19,161,17,247,238,186,39,58,
-238,245,100,204,126,56,144,61,52,223,201,216,105,13,108,38,239,191,156,15,158,78,102,163,42,155,70,251,120,209,
-231,58,67,60,154,142,6,23,58,105,14,166,185,66,10,205,98,233,214,254,201,96,158,140,14,46,6,185,218,221,
-166,201,159,121,109,107,132,109,161,48,56,116,65,20,184,149,184,187,211,225,242,226,14,171,191,223,127,147,84,113,
-29,236,156,71,103,240,144,181,220,27,210,164,102,102,254,96,122,65,43,4,205,223,104,248,183,227,99,142,49,254,
-29,159,187,4,53,230,15,92,204,42,81,252,103,99,147,225,111,26,169,142,168,6,157,127,255,141,89,51,100,141,
-80,8,229,66,184,153,255,73,128,88,250,251,79,227,15,213,254,255,49,251,88,80,2,25,208,4,111,3,131,45,
-133,252,90,65,3,81,198,142,228,10,136,45,77,240,29,6,138,174,206,0,111,119,10,25,247,131,16,183,246,86,
-127,121,213,109,188,7,54,255,217,255,106,237,217,71,11,255,226,7,216,16,184,63,223,223,182,3,88,58,255,27,
-255,211,6,130,32,69,97,42,148,65,198,174,189,37,245,215,199,225,158,115,15,191,67,112,62,179,97,30,11,251,
-171,189,255,113,252,199,35,73,62,10,178,94,122,255,235,1,249,95,233,252,227,91,67,187,3,163,89,161,190,150,
-82,64,69,83,65,123,130,161,171,50,192,249,141,163,4,131,160,89,32,62,64,113,34,43,53,194,219,190,192,100,
-178,33,186,243,79,139,240,156,191,248,163,40,239,51,147,63,206,191,63,141,202,141,172,208,15,206,161,63,125,198,
-63,174,8,178,221,29,172,83,29,108,48,61,172,147,26,125,113,26,113,88,39,101,229,8,120,161,25,96,87,50,
-14,168,3,110,232,27,0,238,51,68,225,27,86,177,10,98,2,20,117,82,61,100,194,58,106,224,39,195,193,44,
-243,7,13,117,61,127,48,24,195,226,26,193,102,26,199,224,24,72,98,29,71,103,111,71,229,25,71,224,24,39,
-225,152,11,227,152,219,224,153,70,225,25,69,98,110,210,229,111,4,230,18,141,194,72,198,97,24,33,30,84,87,
-16,131,202,220,246,41,26,72,136,156,189,7,57,242,120,12,187,79,135,11,203,118,43,203,96,117,27,129,121,147,
-220,174,8,222,102,102,130,52,20,4,252,88,2,30,53,30,127,136,134,235,147,74,226,23,244,120,33,46,130,83,
-59,154,233,226,225,150,235,104,109,240,183,114,77,192,205,225,223,202,204,34,179,138,206,223,170,177,255,239,125,102,
-102,19,180,188,0,224,137,228,127,167,21,192,68,175,57,15,79,223,222,114,27,110,74,70,224,29,19,179,246,188,
-253,37,147,94,49,209,24,71,55,221,163,217,138,178,1,195,121,191,227,237,177,142,146,154,183,234,65,59,151,160,
-111,114,226,142,192,216,244,93,216,180,248,225,8,0,84,135,165,182,248,31,129,230,63,242,122,158,18,180,91,184,
-34,57,108,207,95,179,192,194,149,53,115,251,164,165,131,51,115,250,222,167,5,61,182,50,44,190,144,164,175,178,
-161,226,235,165,139,205,18,171,25,31,217,114,71,184,3,125,235,49,59,81,42,155,220,15,148,89,178,98,185,124,
-197,67,147,55,84,167,191,157,173,156,13,48,65,77,56,94,214,109,212,206,161,78,239,45,100,173,155,252,129,118,
-254,117,55,217,22,88,65,70,216,37,35,244,190,5,144,109,88,184,211,7,82,134,88,131,33,116,151,143,145,200,
-51,200,100,222,174,240,131,224,119,13,246,7,71,97,33,209,139,205,87,148,46,0,78,33,94,160,15,73,185,133,
-26,138,100,178,18,192,166,145,93,172,9,89,51,69,207,139,241,48,16,35,59,248,230,68,76,104,118,23,98,195,
-189,13,156,233,136,91,146,80,50,135,197,43,191,126,23,248,118,183,206,23,126,157,231,245,207,202,107,72,157,215,
-72,44,212,200,48,65,65,108,145,193,152,22,202,237,84,223,37,31,24,34,1,190,66,151,102,10,169,78,226,195,
-99,202,16,146,92,79,144,232,115,123,24,50,103,206,207,239,75,19,235,19,147,23,191,124,198,56,223,130,250,237,
-199,154,2,21,248,77,116,75,113,29,205,177,82,2,15,252,217,249,119,21,79,32,102,116,145,2,100,23,213,249,
-53,199,130,22,254,221,56,56,215,76,114,98,106,24,224,17,149,251,15,207,253,0,161,142,122,197,132,13,22,185,
-241,121,86,85,97,121,85,139,19,126,238,74,229,187,160,185,218,227,73,1,221,30,81,31,208,203,5,115,217,235,
-79,197,94,67,183,186,9,220,112,92,171,8,20,118,252,32,244,230,55,80,32,9,222,231,147,40,158,161,150,190,
-126,189,193,17,180,161,7,30,253,129,241,185,215,68,76,192,150,212,91,33,231,11,24,195,70,226,97,35,140,178,
-99,191,208,147,156,38,226,205,60,195,43,128,199,51,184,235,191,223,70,27,231,10,86,88,236,207,56,48,157,228,
-177,153,72,25,195,112,213,143,216,89,95,31,80,230,7,89,233,28,6,200,48,126,38,150,23,12,10,69,67,203,
-155,88,4,7,95,68,103,132,205,186,157,186,91,86,144,53,97,191,109,80,152,63,229,97,240,43,210,96,9,59,
-211,237,107,217,126,240,51,191,41,155,111,19,244,234,232,43,39,104,40,200,142,194,98,219,218,13,176,192,137,193,
-237,168,35,225,43,4,45,12,31,49,62,202,198,78,192,6,244,250,13,108,117,38,153,225,176,57,98,243,169,229,
-36,146,160,93,197,2,72,195,247,250,156,110,196,161,226,253,54,159,116,243,225,54,33,217,189,236,228,249,247,186,
-164,20,183,246,67,7,159,231,215,63,223,159,247,200,186,54,142,184,109,153,11,0,131,79,163,19,31,31,111,227,
-51,212,92,50,162,81,246,121,229,120,67,72,218,220,104,127,7,194,224,63,179,250,122,174,238,137,233,247,243,100,
-235,190,218,176,25,124,226,54,197,196,238,114,89,171,37,182,219,244,44,162,231,154,191,190,163,20,145,237,53,217,
-216,64,51,14,86,145,91,27,186,76,133,16,148,94,243,46,171,110,60,183,166,9,13,239,49,146,116,70,183,39,
-230,123,170,109,39,133,125,74,68,25,191,119,186,193,240,118,221,77,185,18,190,68,124,241,232,128,138,190,121,243,
-150,88,228,153,13,143,156,14,19,6,174,81,151,208,26,52,9,16,35,76,192,248,120,241,58,244,119,166,163,78,
-143,252,102,37,244,44,56,5,44,183,177,106,85,209,129,102,10,73,136,209,0,16,208,118,86,227,64,84,58,98,
-178,47,54,160,195,53,106,6,208,11,38,38,11,181,66,165,43,3,182,185,119,209,217,188,138,100,131,35,222,2,
-200,213,185,48,129,161,203,215,198,113,218,79,151,156,198,207,81,253,50,12,145,152,57,155,96,27,103,97,29,63,
-130,27,252,120,241,153,125,87,54,83,5,202,87,144,199,46,57,140,250,119,185,210,110,223,114,68,196,62,171,77,
-111,203,57,246,212,34,204,140,123,51,61,187,73,226,175,26,75,224,182,154,136,19,171,136,104,105,221,25,28,74,
-12,92,96,17,66,0,110,204,123,217,21,161,80,15,174,223,210,202,49,117,254,98,158,54,118,124,59,104,114,231,
-211,136,94,11,73,156,3,87,114,234,41,185,87,225,73,169,137,198,220,232,85,98,154,31,34,222,205,167,67,218,
-203,152,181,64,56,199,205,177,208,3,231,252,29,191,147,75,102,128,92,157,16,150,146,208,154,153,210,63,37,139,
-199,132,14,148,68,197,245,10,30,219,50,105,39,146,72,84,109,79,249,180,97,62,44,60,98,151,33,132,25,23,
-183,78,29,216,8,103,61,50,110,148,8,97,99,169,122,183,149,0,51,7,2,208,68,7,86,128,116,130,120,13,
-65,189,49,196,64,162,97,13,207,26,68,79,162,24,206,41,86,10,115,130,77,93,222,142,113,118,110,130,136,70,
-45,220,195,49,136,83,214,117,8,226,238,152,199,107,241,237,89,174,139,227,190,158,21,248,32,160,59,83,29,110,
-128,54,219,9,196,102,58,212,132,79,167,87,91,71,147,229,246,93,76,218,222,140,230,109,166,18,218,91,209,103,
-52,148,147,161,92,54,236,60,169,57,252,29,221,117,248,170,66,172,118,178,201,25,126,90,162,123,198,195,52,165,
-146,184,63,49,239,185,200,51,115,204,77,119,202,211,184,104,31,201,3,88,180,241,161,48,238,76,212,133,251,43,
-37,121,241,241,131,128,102,138,224,34,110,67,67,88,63,133,146,85,246,76,28,19,185,220,43,227,84,192,221,219,
-202,192,80,235,201,195,156,255,205,43,191,13,28,36,169,44,43,253,138,194,110,86,51,167,99,154,221,149,87,157,
-1,44,143,140,162,136,132,128,14,55,37,189,98,246,29,164,187,88,126,97,250,166,41,180,79,59,118,110,35,102,
-217,228,67,89,23,82,94,197,141,84,79,138,10,173,46,111,217,245,3,208,229,203,16,155,140,161,118,13,155,167,
-207,197,42,137,35,203,15,127,66,114,245,248,123,188,122,195,67,189,220,221,244,97,154,218,104,114,1,249,67,95,
-125,48,99,90,145,36,216,137,198,116,102,66,115,212,102,156,111,171,148,85,240,72,251,116,218,84,140,182,77,176,
-218,73,182,156,214,219,219,88,91,111,202,122,31,44,17,104,129,121,113,221,106,35,116,151,51,48,185,208,121,66,
-103,8,52,184,204,61,232,34,101,122,35,156,174,203,213,212,50,142,43,93,16,19,225,200,249,56,28,147,5,152,
-68,157,134,151,242,204,148,143,217,126,238,216,197,142,117,182,51,214,149,226,243,182,16,94,3,246,84,157,2,155,
-97,15,65,210,172,190,203,253,113,25,136,2,241,236,175,182,98,175,234,44,172,6,28,112,33,183,167,161,125,241,
-88,57,110,244,134,223,138,58,255,26,192,86,214,213,47,235,136,41,181,48,123,51,203,32,147,86,97,116,153,56,
-150,229,231,78,186,209,249,125,96,53,212,19,25,78,94,50,11,12,89,73,130,63,137,226,50,251,25,134,130,146,
-219,127,122,201,44,152,239,96,109,176,235,169,153,35,154,153,33,62,65,56,125,3,60,228,134,208,161,15,134,211,
-195,65,207,173,177,230,30,197,227,57,116,226,146,51,53,149,99,162,11,71,206,213,137,140,122,107,189,104,237,152,
-207,154,89,7,102,164,98,135,217,167,224,171,138,119,54,225,31,7,8,22,150,70,106,65,69,182,13,55,196,26,
-222,23,101,38,196,10,168,121,0,173,196,126,220,156,214,177,165,142,205,198,30,47,135,199,219,154,112,126,9,64,
-38,235,191,55,215,249,103,136,6,49,226,67,84,114,96,226,29,46,141,84,182,55,159,231,95,87,67,43,194,186,
-86,18,91,155,194,12,92,182,32,208,179,120,138,214,100,248,154,174,102,104,229,5,233,20,77,234,50,163,88,87,
-179,56,58,42,232,15,68,45,119,89,89,10,187,248,137,235,138,103,85,208,195,92,12,5,235,145,238,46,228,166,
-67,28,29,205,26,207,214,38,27,245,172,133,38,48,6,9,47,58,111,98,173,159,175,205,222,202,100,1,29,120,
-155,192,97,74,130,223,249,93,23,139,168,43,2,177,173,251,253,178,10,124,117,38,63,205,179,154,124,68,215,127,
-9,150,117,32,158,105,58,119,106,201,45,221,161,29,189,228,248,50,116,158,46,129,17,50,176,155,236,29,90,154,
-174,250,188,246,41,220,13,139,195,1,44,213,184,115,161,111,152,31,144,214,232,87,238,59,131,106,13,86,47,49,
-174,206,132,236,14,28,171,194,14,43,188,160,91,72,112,180,175,95,224,178,157,66,102,82,185,117,234,62,81,139,
-151,195,167,108,112,194,83,80,9,15,13,71,67,249,10,63,116,35,106,30,247,163,116,165,147,230,173,248,160,137,
-43,49,194,176,119,73,182,73,117,226,30,100,165,43,96,54,133,37,107,5,214,220,197,53,45,187,115,226,180,43,
-124,169,226,76,241,8,99,32,180,245,69,111,63,28,126,162,25,110,253,33,116,212,38,208,201,246,121,128,123,137,
-160,213,249,226,156,217,201,121,10,52,216,168,140,153,100,26,69,105,142,59,76,206,105,158,215,1,102,133,70,205,
-27,221,9,35,57,41,119,246,25,176,0,187,76,66,172,209,49,46,99,216,0,242,242,232,81,245,136,248,88,221,
-219,46,40,187,133,207,27,46,88,54,88,199,53,41,21,210,49,250,94,25,38,118,67,77,25,228,88,144,145,17,
-123,246,167,49,202,241,19,167,82,100,94,251,103,223,88,52,18,113,44,55,118,20,179,214,141,170,63,142,32,19,
-57,17,39,195,230,79,198,245,102,159,239,136,132,191,250,47,225,37,60,100,107,246,55,179,240,85,187,3,210,83,
-20,230,6,44,135,9,145,163,187,55,235,18,137,246,46,231,122,10,107,200,20,251,220,191,1,71,189,131,213,168,
-75,146,64,207,193,152,155,33,152,13,30,64,4,116,39,155,102,42,162,189,248,181,82,153,24,130,169,159,27,103,
-126,219,212,195,186,241,192,144,53,78,202,7,153,243,89,55,187,111,141,29,112,183,122,29,92,157,127,107,1,73,
-122,58,200,24,82,198,171,213,243,200,53,142,235,249,249,248,114,116,92,69,154,43,66,110,82,162,79,26,223,123,
-253,134,48,131,90,81,98,164,130,32,118,197,192,6,150,55,4,162,83,222,20,111,57,73,25,127,144,112,45,173,
-124,19,249,241,34,252,166,62,131,184,68,228,192,14,230,140,17,122,135,27,157,141,72,244,82,230,19,39,102,253,
-226,152,252,245,96,76,84,228,249,49,42,230,66,160,117,245,79,62,59,232,32,187,167,92,109,231,155,241,236,92,
-55,72,178,64,243,29,30,71,201,102,226,239,0,248,61,234,239,80,65,234,235,162,81,83,87,71,212,21,118,85,
-233,193,194,245,247,137,28,22,196,29,92,112,161,9,57,105,224,217,233,19,52,134,21,79,100,25,152,158,181,47,
-211,227,140,55,161,132,185,164,185,141,126,125,254,60,24,202,104,27,64,47,97,43,124,12,155,128,170,8,16,185,
-132,240,64,244,28,199,232,214,45,194,155,85,173,90,240,150,56,130,198,177,138,68,168,93,198,134,30,124,66,51,
-195,74,170,202,75,104,252,40,94,191,22,200,106,204,158,152,180,199,23,178,176,120,221,193,66,104,110,119,143,146,
-121,4,136,1,159,51,107,189,238,130,240,110,30,36,76,53,246,17,59,205,120,79,88,1,58,222,144,71,70,122,
-154,16,133,38,242,69,136,117,112,115,132,202,199,214,173,155,28,155,87,138,221,59,145,141,153,84,117,25,115,110,
-74,178,87,21,210,66,7,98,229,84,251,120,208,183,149,89,207,19,145,3,177,213,191,195,61,51,193,177,251,182,
-47,44,82,141,255,134,46,241,103,41,154,54,141,57,5,125,119,228,119,145,194,206,176,179,226,221,174,89,130,123,
-193,134,251,187,222,69,234,126,198,5,183,128,51,123,21,18,34,158,121,255,218,66,234,206,40,123,120,11,255,205,
-56,241,62,98,157,236,127,37,140,116,51,156,2,239,149,163,69,56,220,61,246,188,52,126,188,22,215,28,81,249,
-133,105,19,175,148,216,19,87,56,112,191,35,131,244,239,253,191,6,247,121,39,10,95,94,105,130,60,221,6,151,
-113,248,237,130,54,72,149,85,140,52,255,190,132,196,228,6,133,22,177,230,193,79,210,80,118,124,60,61,110,225,
-51,219,24,16,153,24,180,89,99,131,49,195,31,179,96,130,221,194,3,34,211,27,254,160,209,97,135,237,206,210,
-27,6,45,169,163,155,240,181,243,56,107,35,128,71,248,64,97,79,1,45,10,7,238,245,58,105,46,247,12,109,
-205,170,165,117,102,78,65,185,154,210,21,244,253,192,73,168,31,176,21,31,170,111,174,86,119,114,201,238,149,194,
-124,85,167,22,194,82,87,199,67,153,230,18,31,122,182,54,145,150,184,14,37,69,189,214,117,96,131,81,235,62,
-166,135,224,235,2,50,146,250,78,136,95,47,79,169,135,170,255,165,113,156,50,143,84,145,140,128,81,63,147,41,
-164,149,184,47,150,115,198,222,11,6,7,14,225,65,89,158,206,163,170,173,248,50,115,233,78,124,109,63,109,165,
-139,47,159,81,246,215,46,182,119,237,58,60,252,174,155,91,139,41,27,44,27,157,94,237,235,222,10,152,57,17,
-83,178,73,181,117,142,190,189,39,0,23,198,42,50,184,190,197,243,76,27,47,185,39,189,202,142,20,97,7,223,
-95,104,70,59,238,114,209,77,115,179,37,181,163,41,98,249,241,83,2,14,159,34,192,161,36,133,98,120,113,43,
-224,58,10,12,92,119,196,232,187,194,127,44,105,241,178,112,11,30,1,59,191,0,110,132,134,212,46,62,125,52,
-178,12,109,121,82,210,246,245,51,203,144,40,97,132,238,85,234,16,31,9,65,244,102,104,47,71,48,178,96,87,
-90,129,198,151,6,167,240,63,252,187,255,145,216,65,178,68,23,8,54,153,91,96,218,21,34,228,56,188,93,53,
-38,153,251,70,121,177,30,134,70,237,66,175,141,57,88,107,253,80,247,14,43,6,193,219,69,77,100,242,3,131,
-21,132,209,87,0,244,185,117,195,102,62,91,123,71,44,61,104,34,254,130,117,200,235,145,85,39,164,210,85,154,
-0,179,24,38,70,253,27,144,175,169,125,114,173,193,106,43,229,2,70,46,25,28,170,34,69,105,116,111,255,226,
-112,22,55,192,11,24,10,106,219,45,111,4,140,27,66,235,249,52,197,157,64,199,1,130,43,153,204,5,212,177,
-113,69,18,7,25,22,19,37,216,10,112,181,240,44,217,110,32,31,212,202,185,250,50,169,107,29,191,110,58,190,
-238,158,164,193,174,168,105,6,104,161,120,245,63,216,208,185,228,190,116,180,234,227,125,131,237,252,124,250,141,101,
-160,205,158,248,37,186,200,61,76,199,11,4,51,111,1,119,114,172,81,127,167,80,220,37,118,190,72,180,166,208,
-188,136,38,174,22,13,16,0,64,101,248,210,207,59,198,206,2,151,107,192,95,80,218,30,176,95,46,114,152,206,
-122,211,198,70,184,156,236,102,136,14,254,14,126,22,170,17,209,240,129,247,208,180,158,216,225,199,198,7,198,214,
-82,69,199,69,119,114,81,75,15,151,91,65,95,6,156,40,210,145,34,239,102,187,62,244,196,73,59,25,120,175,
-129,143,175,206,62,92,127,220,71,165,218,237,232,30,2,227,37,101,190,27,189,125,244,16,145,147,134,69,252,96,
-25,98,133,249,240,204,101,219,149,31,68,48,31,205,95,95,111,146,122,142,146,185,98,32,126,16,240,142,5,193,
-198,196,34,19,109,32,182,158,164,237,133,10,220,141,202,115,193,10,12,10,247,10,178,153,88,137,39,82,55,168,
-106,217,194,234,26,243,159,192,51,245,167,80,112,25,192,152,41,146,126,0,228,245,74,179,61,33,159,69,144,192,
-244,65,34,83,1,105,116,47,95,212,175,63,105,93,165,53,189,252,224,21,162,72,57,185,48,252,49,178,22,52,
-183,4,119,227,254,124,63,242,129,191,174,12,31,154,88,21,104,27,164,44,146,33,202,50,114,253,53,55,237,17,
-132,48,93,231,229,124,250,120,136,161,196,11,199,182,29,74,203,220,106,238,125,119,53,25,165,146,196,136,97,53,
-117,237,11,132,249,104,107,59,20,165,50,129,176,231,200,87,88,146,232,68,126,84,239,227,238,198,18,6,15,131,
-69,167,209,231,36,132,173,202,120,61,204,19,57,67,203,32,63,230,156,198,109,191,170,137,18,79,226,118,41,53,
-238,159,138,37,110,60,28,249,217,190,221,236,138,63,69,247,112,11,149,192,76,167,54,10,190,127,26,150,68,241,
-241,122,167,255,134,111,216,230,31,6,19,51,116,175,75,50,174,105,90,22,42,71,233,220,123,182,104,180,166,43,
-65,170,177,171,27,231,189,206,233,25,211,123,30,254,249,33,157,213,250,44,186,17,91,129,168,96,21,194,50,47,
-31,228,143,203,198,221,220,47,239,177,13,26,54,77,77,184,225,36,246,125,239,116,187,209,95,154,129,252,208,198,
-9,38,180,35,121,25,242,21,239,170,145,86,96,230,167,55,21,221,195,117,146,37,213,40,157,138,134,62,70,68,
-166,63,186,132,19,120,13,242,104,18,220,28,144,135,92,181,30,40,28,71,57,52,167,66,16,210,52,83,162,235,
-45,119,171,203,246,187,209,25,199,240,80,63,228,181,203,59,21,106,88,222,201,191,102,0,214,196,82,156,114,198,
-81,185,175,132,152,25,55,137,79,226,75,77,51,16,105,217,165,237,117,82,228,198,56,96,199,214,208,201,36,18,
-162,48,23,86,93,32,248,203,190,210,122,108,188,161,191,69,60,31,209,64,206,228,37,31,63,177,201,18,79,250,
-237,166,235,101,124,243,133,139,52,8,156,36,154,89,113,34,218,254,110,150,181,158,11,63,97,45,220,182,90,120,
-154,120,19,10,97,94,226,114,194,59,205,165,23,11,246,193,203,11,186,226,41,180,62,207,237,107,181,171,253,208,
-10,110,202,113,198,245,61,144,246,125,45,208,10,1,158,100,79,136,126,189,190,230,234,201,246,36,239,13,80,212,
-226,204,176,109,239,13,164,114,135,168,195,41,77,122,104,220,136,34,107,245,103,70,214,48,196,163,102,115,134,222,
-93,238,113,219,136,37,180,94,43,0,23,158,56,216,115,229,10,44,72,110,122,57,237,82,11,57,38,103,201,26,
-26,6,46,205,232,21,167,38,185,216,101,54,62,171,162,102,184,38,26,86,38,1,84,206,241,200,241,118,130,105,
-83,210,7,109,165,159,226,131,69,246,100,61,211,35,135,48,13,243,95,134,194,77,248,13,140,125,224,202,136,137,
-250,189,243,207,200,170,110,128,11,219,79,109,154,255,175,181,51,216,137,27,6,194,240,189,79,177,88,43,228,8,
-19,216,86,189,176,178,80,91,85,106,43,164,94,184,33,14,145,107,32,109,136,87,241,172,40,10,121,247,206,100,
-38,94,111,186,173,122,232,9,199,153,140,199,227,73,56,204,247,195,189,181,106,81,53,96,85,250,107,246,8,116,
-171,29,128,113,31,212,89,66,0,184,69,94,73,83,60,252,51,13,229,119,150,9,210,90,228,130,223,223,161,1,
-70,155,66,34,156,42,194,27,185,21,205,93,236,155,22,65,223,119,214,90,141,141,48,238,99,87,151,85,226,114,
-42,106,105,115,119,12,240,7,182,180,57,236,228,135,91,218,245,5,152,48,131,19,12,61,187,215,167,187,98,73,
-0,247,234,130,85,79,17,123,136,234,36,201,23,154,224,42,50,44,31,66,132,19,117,134,2,158,56,230,242,41,
-42,161,143,187,17,151,166,36,19,189,0,58,48,39,239,108,159,58,123,136,243,26,86,231,42,101,26,50,227,41,
-65,132,104,86,184,129,108,200,10,12,198,151,135,117,21,159,91,183,200,244,37,69,175,212,145,181,142,73,167,18,
-186,250,81,83,199,191,43,35,82,141,122,127,190,48,94,159,27,153,179,184,134,195,20,117,101,104,195,198,183,185,
-104,135,205,82,224,196,244,58,76,38,153,186,38,68,255,87,219,21,218,154,232,225,186,126,244,97,11,76,171,166,
-12,118,158,192,21,138,229,173,127,35,62,133,130,204,89,95,113,43,73,56,177,140,68,145,103,39,124,200,203,75,
-50,201,242,84,70,215,133,166,185,14,27,251,135,91,159,198,110,111,218,143,39,85,197,127,220,207,189,214,227,33,
-145,81,15,221,115,95,61,85,53,44,246,15,78,239,248,102,190,125,231,1,33,220,172,176,78,107,100,22,9,249,
-198,246,245,72,219,71,168,96,27,165,179,47,79,65,249,61,146,179,53,199,60,21,146,109,211,144,182,57,117,153,
-7,172,121,87,209,58,192,203,135,198,147,100,18,47,135,161,224,114,173,77,92,139,61,241,194,194,117,219,113,51,
-171,227,29,177,127,124,236,53,86,174,85,10,131,155,23,217,220,240,181,137,98,152,64,185,193,220,56,131,139,153,
-198,204,83,47,199,107,143,166,17,237,97,110,149,60,161,227,249,253,169,190,225,161,142,76,7,114,217,163,21,224,
-54,24,159,85,99,82,127,120,12,176,209,243,231,197,247,33,15,121,137,126,184,129,75,181,109,227,67,125,7,234,
-66,17,112,173,110,5,206,158,23,159,133,201,5,190,114,183,114,38,36,235,225,47,241,194,255,4,124,95,35,95,
-245,75,193,193,49,154,163,125,102,80,160,111,166,194,69,51,226,51,122,93,7,237,203,29,79,94,152,252,230,110,
-92,142,146,150,220,50,243,98,201,175,241,163,214,0,101,10,131,166,60,152,85,97,198,124,76,177,89,24,150,243,
-168,216,96,89,38,97,3,106,6,144,97,58,52,77,158,167,82,243,12,171,99,68,25,216,14,24,209,72,34,127,
-189,35,254,225,116,133,59,29,247,16,55,77,237,188,6,140,104,24,150,209,3,157,5,33,234,237,90,22,138,158,
-50,209,90,48,231,248,16,43,7,233,172,35,58,154,244,58,104,32,214,153,238,129,62,116,50,203,126,205,33,27,
-90,151,131,236,182,14,66,71,235,199,237,198,119,186,48,31,57,89,96,174,204,23,227,76,63,160,173,238,153,170,
-191,72,191,79,240,66,234,226,253,243,231,111,122,20,83,22,104,138,175,242,43,84,92,138,156,18,71,34,186,60,
-227,127,135,243,11,206,207,165,242,31,103,0,0
+31,139,8,0,0,0,0,0,2,3,205,125,105,119,226,200,178,224,231,185,191,130,246,235,91,141,47,50,104,65,2,236,162,234,129,216,
+247,85,32,234,213,185,71,104,7,33,9,45,8,112,251,191,79,164,36,12,216,216,213,253,230,204,155,169,170,182,82,153,145,145,145,177,
+101,68,42,211,253,245,183,74,159,157,240,131,106,66,243,54,198,183,127,124,69,143,132,33,152,106,241,78,54,239,80,133,44,72,223,254,
+241,191,190,110,100,79,72,136,154,224,184,178,87,252,195,247,148,135,252,31,175,245,166,176,145,139,127,236,116,57,176,45,199,251,35,33,
+90,166,39,155,0,23,232,146,167,21,37,121,167,139,242,67,248,130,233,166,238,233,130,241,224,138,130,33,23,9,64,2,88,60,221,51,
+228,111,51,121,57,150,29,104,76,12,28,235,107,38,170,132,86,215,59,160,66,2,254,252,11,251,215,163,160,120,178,3,207,165,172,88,
+142,252,188,180,246,15,174,126,212,77,245,81,55,53,232,239,189,160,89,92,214,47,45,71,146,157,7,168,121,82,128,52,84,45,63,50,
+100,154,254,231,203,210,146,14,207,162,101,88,206,227,127,208,56,195,20,240,8,68,17,54,186,113,120,252,99,100,45,45,207,250,3,75,
+252,209,144,141,157,236,233,162,144,232,201,190,124,85,131,94,74,136,112,40,184,130,233,62,184,64,134,114,49,22,145,102,228,77,244,30,
+200,186,170,121,143,20,142,63,25,178,7,51,121,112,109,65,68,84,166,113,2,128,12,221,148,31,180,8,8,186,189,44,13,75,92,111,
+125,203,67,51,13,167,97,200,138,247,136,167,41,71,222,36,92,203,208,165,196,127,40,132,146,85,242,79,27,193,81,117,51,6,56,189,
+57,33,42,252,201,22,36,9,13,67,160,126,68,154,134,199,5,242,196,191,30,13,193,245,30,68,77,55,164,231,184,43,76,221,179,54,
+143,248,75,122,233,67,201,196,226,135,110,218,190,247,195,59,216,32,245,168,234,143,159,87,149,142,12,106,242,166,206,245,151,27,29,42,
+159,151,130,184,86,29,203,55,165,135,152,241,100,190,194,148,11,79,209,252,96,106,196,197,212,174,218,30,28,65,210,125,247,49,157,5,
+136,167,184,183,162,40,79,162,239,184,80,182,45,29,52,207,121,146,116,215,54,132,3,40,68,200,206,112,154,87,226,64,35,92,201,35,
+7,242,136,185,78,165,243,168,245,173,116,194,46,151,210,137,225,78,124,197,19,84,26,71,21,158,188,247,30,4,67,87,205,71,81,14,
+201,9,107,36,89,180,28,193,211,45,243,209,180,76,57,170,244,28,80,23,80,227,205,163,111,219,178,35,10,174,252,20,104,186,39,135,
+227,202,0,25,56,130,125,226,255,163,98,137,190,139,157,222,52,107,7,134,112,213,116,213,114,75,76,49,220,205,166,247,189,98,57,222,
+232,116,106,121,223,231,36,231,27,157,94,155,194,94,55,20,33,182,192,88,216,215,149,23,210,182,124,15,9,226,172,152,63,64,224,194,
+210,144,165,159,216,187,138,91,83,253,160,57,158,212,7,173,39,234,207,205,207,177,218,73,178,34,248,134,247,100,33,93,241,14,143,105,
+250,61,97,215,178,187,168,191,148,226,59,240,15,160,63,159,211,39,50,254,20,211,187,233,127,44,247,79,241,188,103,212,39,186,240,22,
+211,175,220,195,117,229,137,207,241,227,33,214,12,236,118,237,45,142,124,6,19,79,246,51,144,211,52,222,192,188,159,69,104,233,182,224,
+128,71,120,250,43,83,184,214,151,183,141,151,74,115,187,227,103,253,254,2,31,62,209,161,95,227,188,205,183,143,181,233,215,24,63,96,
+243,39,122,117,19,231,231,98,249,204,237,68,111,31,200,234,35,43,255,24,236,19,249,125,224,3,126,133,235,47,72,234,47,121,136,191,
+51,206,109,241,253,21,255,241,119,70,249,64,162,127,201,187,252,98,156,231,43,145,199,225,227,231,230,41,26,178,240,86,114,81,221,103,
+220,124,15,241,134,17,239,1,222,78,33,132,248,27,10,252,151,29,78,136,248,182,226,70,77,183,148,245,178,211,199,125,126,201,146,191,
+160,136,31,225,187,197,192,95,43,220,71,216,110,114,251,47,40,214,5,190,255,51,217,220,118,48,33,250,95,185,151,183,64,31,202,235,
+23,174,229,54,158,95,202,230,111,185,149,95,143,113,75,96,127,199,165,252,122,132,155,50,252,91,238,228,230,24,207,215,86,38,90,210,
+101,24,240,120,74,210,110,101,50,231,212,36,207,252,51,78,220,32,161,72,147,151,9,70,248,150,8,19,183,91,57,130,237,124,54,220,
+141,164,49,14,171,16,233,138,97,5,15,135,71,77,151,36,217,68,152,190,69,212,95,145,138,191,166,85,81,62,117,35,161,188,162,11,
+208,188,104,39,23,251,248,26,213,123,150,253,38,197,187,202,94,31,163,44,42,129,191,92,10,32,100,237,155,132,82,18,60,249,70,149,
+167,111,62,170,126,0,186,33,73,191,110,148,55,130,254,182,110,3,242,208,222,212,153,254,102,41,191,165,193,22,92,55,128,121,189,205,
+117,65,61,196,183,8,60,217,120,87,179,127,155,37,251,206,91,160,64,150,215,167,42,144,181,151,12,235,127,222,99,168,55,184,16,1,
+115,101,67,22,189,103,72,101,151,107,29,82,79,200,36,5,112,48,161,106,64,162,249,23,220,210,109,129,220,210,212,112,87,69,19,36,
+43,136,145,191,219,125,121,186,157,30,167,153,72,77,66,225,166,115,161,178,160,13,161,71,2,199,255,121,75,214,55,204,48,146,248,7,
+13,145,220,63,105,60,73,255,6,72,172,3,55,90,98,77,184,209,114,210,135,27,77,103,173,184,229,75,98,221,184,209,20,106,200,205,
+250,253,237,132,58,212,150,27,245,145,206,92,54,92,106,78,92,127,210,159,248,53,210,162,232,229,249,86,174,117,145,118,199,26,119,225,
+110,128,146,36,226,180,240,168,111,4,85,206,184,59,53,181,223,24,79,190,167,228,177,175,240,150,128,55,211,45,222,105,158,103,63,102,
+50,65,16,164,3,42,109,57,106,134,196,113,28,193,223,37,208,14,98,217,218,23,239,240,4,158,160,240,68,254,46,17,237,32,222,81,
+248,221,183,175,182,224,105,9,69,55,140,226,221,63,73,42,82,210,187,132,84,188,235,226,24,110,48,88,222,96,30,242,119,153,111,95,
+17,182,111,127,220,39,162,237,151,68,184,3,150,48,173,7,71,6,203,240,78,42,25,239,140,69,254,230,229,122,250,103,147,9,167,243,
+255,96,122,17,207,63,155,94,76,242,143,141,111,120,186,109,200,151,59,107,145,113,198,150,40,248,158,245,114,146,246,243,70,55,79,59,
+88,76,180,11,104,8,75,217,192,12,89,149,77,233,249,218,199,95,109,97,222,218,51,187,222,41,140,240,41,186,108,72,176,38,159,180,
+40,178,243,243,14,228,27,215,174,201,226,26,220,200,219,45,68,240,58,214,31,63,159,175,183,242,94,210,33,177,15,209,219,243,199,251,
+124,49,137,166,229,108,4,227,106,99,52,162,49,141,246,168,5,232,228,60,191,46,183,136,79,0,186,143,9,38,8,50,218,208,59,239,
+240,157,42,44,87,15,55,242,28,217,16,60,125,39,95,186,178,180,99,5,175,132,41,134,188,127,66,63,30,36,221,1,97,161,78,96,
+84,254,198,60,99,125,219,25,253,247,0,218,26,3,60,159,217,118,163,245,91,58,66,119,11,10,133,5,207,225,224,168,244,24,237,36,
+158,26,97,25,126,14,55,41,31,96,197,222,184,33,165,15,46,168,136,119,134,137,164,250,30,12,244,228,12,20,25,217,21,80,84,117,
+6,113,61,71,246,68,237,10,38,174,187,24,76,0,125,70,66,189,132,58,85,134,96,137,211,92,223,232,40,144,244,72,36,136,147,252,
+174,247,192,95,165,9,236,125,203,233,19,194,248,241,96,41,10,168,237,3,129,63,95,98,33,62,135,38,175,161,201,95,64,211,215,208,
+244,167,208,20,133,125,214,154,189,194,69,81,105,10,254,124,138,48,123,77,108,246,115,98,233,107,104,250,115,104,230,26,154,249,5,52,
+243,217,212,152,220,53,46,38,205,192,159,79,17,230,174,57,155,251,156,179,249,107,98,243,159,19,91,184,134,46,124,0,13,138,19,42,
+35,242,239,160,53,87,218,119,187,7,121,209,131,188,234,241,145,30,129,2,157,123,208,87,61,62,152,241,7,74,4,218,243,138,232,164,
+58,23,216,62,213,166,236,5,217,217,43,178,63,210,40,250,162,7,125,213,227,35,173,98,46,122,48,87,61,62,210,172,15,84,10,116,
+233,140,40,86,164,75,108,159,233,86,238,130,219,185,43,110,127,164,95,249,11,178,243,87,100,127,164,99,133,139,30,133,171,30,111,245,
+236,244,188,112,222,224,30,149,183,190,251,29,248,149,31,63,247,56,185,241,119,240,87,46,61,132,143,61,250,127,110,100,73,23,146,40,
+132,136,40,4,233,195,130,120,255,28,46,122,111,214,57,168,186,242,198,15,81,240,31,59,97,8,197,197,36,242,196,137,84,188,172,222,
+95,59,249,235,200,226,148,92,156,215,226,8,219,203,139,112,157,119,223,252,216,246,114,10,114,133,235,84,61,222,116,145,12,204,50,48,
+223,120,54,116,23,194,29,244,185,57,10,160,98,26,194,148,245,53,108,140,150,22,232,148,128,126,240,211,10,127,250,8,71,34,196,132,
+106,172,176,198,15,107,252,176,198,71,53,207,231,128,42,18,117,24,122,68,201,51,114,26,81,33,14,73,173,43,130,96,74,16,123,26,
+9,221,116,117,73,126,185,166,86,212,29,209,144,79,109,111,62,215,74,18,38,121,152,161,191,97,105,204,192,83,180,22,69,95,113,26,
+128,157,195,197,55,125,222,124,55,134,169,99,138,174,250,142,140,161,207,152,136,143,54,6,153,63,230,161,173,17,196,211,107,4,100,132,
+32,108,61,197,135,167,79,172,111,55,24,94,119,38,246,97,8,123,249,97,21,201,224,114,53,247,36,204,211,158,95,191,243,71,159,173,
+175,114,218,60,83,16,150,249,243,166,69,180,155,18,207,199,147,30,21,221,57,125,254,6,84,151,175,207,111,4,15,192,231,79,229,8,
+246,226,195,249,117,106,129,127,108,48,17,3,78,243,13,223,46,231,27,159,146,120,121,89,98,16,40,89,16,5,94,70,181,75,203,144,
+94,236,231,75,237,124,209,8,76,35,49,141,194,180,44,166,209,152,198,60,255,226,184,193,67,244,69,251,173,120,240,139,202,19,230,11,
+173,205,70,105,192,245,41,5,242,69,35,47,96,168,155,48,244,139,70,93,0,145,241,87,246,43,32,234,69,203,94,193,144,55,190,196,
+63,164,241,91,93,1,63,253,124,153,175,228,111,247,165,223,247,133,174,204,243,187,84,231,77,87,252,77,167,236,139,190,81,159,175,3,
+76,72,43,208,206,160,162,239,163,83,42,207,209,246,48,48,87,123,138,15,197,60,254,145,248,227,233,74,238,47,105,16,186,224,133,234,
+245,28,22,67,245,62,85,135,170,20,215,135,229,151,116,104,8,27,223,147,165,147,35,139,180,59,241,155,190,65,39,112,4,211,187,72,
+112,30,246,39,35,124,68,91,56,97,152,252,146,222,64,219,67,236,106,207,11,214,213,18,7,111,159,120,252,155,8,96,85,188,32,226,
+122,185,188,164,238,6,94,230,51,188,16,36,220,198,123,221,240,242,146,94,249,174,167,43,135,135,152,221,167,181,236,77,245,107,138,18,
+178,50,134,121,119,112,35,202,83,159,195,253,178,40,225,139,60,76,34,77,208,110,2,169,131,16,195,60,62,130,60,69,89,3,195,60,
+175,46,145,80,128,213,22,88,179,229,60,156,83,206,119,9,228,43,208,243,155,29,212,48,117,59,37,242,36,142,219,251,11,183,247,198,
+120,67,123,118,228,80,135,193,149,160,147,73,198,251,221,191,55,187,123,113,114,110,239,207,116,250,158,110,0,121,178,123,166,83,88,130,
+27,5,133,123,66,46,129,68,84,68,30,46,139,138,175,27,143,38,44,80,33,184,34,72,114,211,172,88,1,196,20,175,156,122,122,216,
+88,199,95,2,253,162,253,85,113,94,53,224,172,144,239,200,71,196,18,103,98,81,241,37,54,209,135,104,109,188,176,122,60,114,24,23,
+123,38,87,6,31,251,171,191,117,102,229,122,172,112,11,238,114,97,185,127,190,222,151,136,54,38,208,210,247,63,68,221,197,80,127,159,
+184,132,187,131,85,73,55,140,71,209,119,208,94,50,139,144,63,157,20,47,54,36,215,95,190,6,78,72,28,89,16,193,199,34,188,29,
+69,94,185,181,139,16,241,6,205,87,75,117,28,224,164,69,193,121,93,153,145,183,167,227,149,63,124,94,57,15,27,166,243,128,136,120,
+239,47,81,211,43,146,184,111,58,71,95,127,189,137,15,150,253,234,8,75,188,163,78,210,160,154,103,15,200,32,77,125,127,120,236,124,
+238,41,158,201,197,22,60,184,198,52,125,142,99,18,142,186,20,146,36,137,37,200,60,150,200,210,24,52,19,247,151,142,243,180,221,255,
+249,78,63,29,205,235,52,219,48,82,34,163,57,95,109,161,24,150,106,157,88,69,156,88,149,120,101,218,147,239,162,245,51,218,88,13,
+195,112,232,33,72,231,45,183,87,200,4,121,102,116,4,18,106,215,27,93,218,232,146,4,97,210,123,119,227,218,186,137,88,112,114,18,
+16,7,43,40,130,146,223,186,156,143,1,255,2,204,137,180,7,36,163,183,97,109,168,104,177,213,158,246,201,195,20,226,34,97,9,15,
+7,94,172,37,111,180,228,114,85,193,18,55,86,154,211,103,95,197,7,45,13,229,240,124,41,141,184,21,17,9,3,134,12,252,127,198,
+170,255,12,177,173,229,131,226,8,27,217,77,32,200,103,68,230,115,216,112,62,246,232,88,158,224,201,73,138,193,37,89,189,135,184,224,
+68,242,205,190,113,219,39,221,255,59,221,158,254,18,190,243,114,244,12,56,79,71,253,240,139,206,97,9,214,115,153,79,62,128,105,223,
+191,132,163,159,32,137,219,144,56,140,130,142,64,103,226,83,206,95,51,209,145,235,175,232,100,50,60,36,125,151,208,165,226,157,96,219,
+119,223,190,102,224,21,42,93,209,209,109,239,219,63,118,192,115,104,40,42,190,25,122,203,228,253,243,29,24,93,2,114,6,93,244,238,
+158,78,245,9,15,90,94,94,223,204,164,119,255,236,200,158,239,132,45,231,6,57,249,90,223,95,174,192,108,211,34,228,128,192,16,19,
+84,238,2,206,66,8,188,52,204,165,42,136,90,210,188,104,114,206,184,239,78,149,119,197,34,218,212,183,148,132,119,6,20,147,30,102,
+158,201,248,173,232,125,55,139,69,243,17,74,69,243,207,63,189,47,95,238,172,144,134,139,222,127,254,249,57,78,35,194,233,165,209,55,
+80,83,98,209,162,112,69,157,142,0,48,25,129,64,174,12,238,165,28,30,34,79,66,221,159,127,190,153,164,27,77,50,250,80,218,179,
+36,57,13,6,12,57,90,132,213,187,128,244,47,248,41,89,162,191,129,14,49,231,170,134,140,222,174,192,75,191,4,239,141,147,159,125,
+73,194,46,177,9,31,99,155,128,163,66,132,95,141,46,157,101,44,36,239,18,119,23,77,74,196,29,204,58,139,37,13,238,171,186,3,
+148,29,221,133,192,89,118,146,17,0,150,188,47,126,243,98,142,220,2,56,99,13,78,60,71,252,45,22,229,239,167,110,37,15,212,20,
+188,22,176,255,254,209,75,171,178,119,89,3,106,32,127,249,226,165,221,171,106,192,115,198,108,159,196,189,19,12,95,46,70,248,205,239,
+119,119,143,230,11,100,111,137,205,217,0,52,196,165,77,241,66,87,84,84,147,188,176,28,93,73,254,182,185,247,52,20,97,152,114,144,
+168,58,142,229,36,239,106,175,10,43,24,134,44,37,192,187,163,77,150,132,104,193,170,106,194,196,19,113,178,174,31,67,175,120,119,255,
+20,51,111,243,114,159,188,79,255,254,123,218,50,255,189,1,63,15,186,228,187,136,144,23,200,4,92,47,177,43,254,248,137,177,232,7,
+135,126,240,232,199,178,56,112,172,141,238,34,101,131,53,122,7,22,137,18,209,196,161,248,27,113,158,205,22,209,206,189,162,67,0,109,
+4,16,225,221,23,17,249,99,217,59,119,152,198,243,107,223,63,3,32,254,36,89,16,91,58,73,212,209,43,130,15,251,186,75,27,178,
+169,66,154,234,165,138,196,253,115,132,200,44,238,126,120,63,159,144,129,99,229,164,9,83,1,230,67,55,45,242,7,216,169,19,96,96,
+79,253,239,217,180,109,217,73,152,249,211,245,8,220,237,17,56,52,194,62,173,9,46,140,242,231,159,201,61,210,56,52,32,136,228,254,
+133,123,29,225,5,18,35,67,78,158,134,140,176,63,241,175,195,242,175,195,34,86,97,136,29,216,62,138,191,193,195,157,197,94,70,172,
+3,86,160,25,128,138,129,19,115,4,21,217,12,210,35,223,70,135,5,146,247,24,56,184,116,116,191,228,223,81,221,253,211,137,96,47,
+13,193,169,119,120,138,159,197,31,15,196,79,236,140,6,169,236,169,156,6,5,77,139,222,30,148,20,32,194,29,129,24,221,171,235,220,
+2,109,17,230,238,123,169,205,35,253,126,32,138,136,80,80,164,112,196,31,248,207,47,95,128,17,177,244,177,3,112,13,230,140,99,203,
+180,167,201,102,114,122,143,70,59,65,167,81,136,14,171,204,101,221,15,51,67,17,127,226,63,255,44,18,95,191,154,255,164,136,51,123,
+170,73,17,51,48,29,243,177,18,38,96,82,56,187,147,176,148,34,36,32,73,241,196,138,160,104,164,109,199,178,221,63,255,124,126,193,
+236,162,8,248,139,207,167,185,63,34,6,99,48,249,168,16,2,62,10,88,52,253,71,152,151,229,253,91,222,250,130,241,88,194,150,225,
+39,235,144,239,177,165,60,130,41,64,89,146,209,238,215,1,189,93,73,3,85,92,178,19,189,135,153,253,30,198,5,46,118,5,59,169,
+124,87,208,132,79,213,63,126,222,99,200,130,81,212,229,134,99,133,172,120,148,48,119,173,219,255,142,72,248,141,120,9,173,77,69,198,
+4,74,98,35,233,21,245,239,58,112,37,192,146,161,35,75,167,211,50,248,190,152,39,86,81,142,85,240,187,12,130,121,52,79,198,31,
+118,253,242,165,20,225,0,37,199,78,133,162,117,15,242,251,205,78,159,7,254,242,197,78,135,5,104,190,44,39,193,209,170,95,190,204,
+97,120,15,36,104,190,220,223,163,169,218,103,69,85,145,224,45,24,228,90,91,1,228,36,136,226,111,191,249,95,190,248,17,29,247,152,
+145,246,32,114,149,35,35,48,210,218,65,114,80,135,120,58,222,57,148,56,175,42,37,199,17,64,143,192,47,33,117,70,171,31,90,84,
+220,251,151,228,43,178,39,251,194,0,206,229,180,129,20,244,28,40,64,31,217,128,248,228,3,104,17,57,59,88,152,65,230,192,161,228,
+46,84,169,179,129,126,249,178,75,235,208,208,77,75,144,83,192,244,119,200,5,233,73,246,30,120,115,166,27,150,31,49,158,207,89,27,
+141,179,106,233,151,154,229,94,235,145,255,18,26,218,147,241,229,139,145,222,36,17,38,108,155,76,38,207,2,151,139,122,122,3,234,101,
+222,35,203,130,174,73,231,254,201,253,238,70,230,24,42,199,163,149,148,99,115,59,13,10,174,29,100,135,249,151,118,143,44,45,230,31,
+20,4,83,212,44,231,30,3,79,253,130,194,186,29,198,130,177,41,23,171,221,17,137,4,105,39,90,96,29,76,4,11,221,96,26,166,
+98,0,138,113,24,143,45,177,3,182,197,218,216,30,155,98,101,172,139,205,177,42,118,44,122,160,150,105,88,176,76,15,162,208,212,221,
+29,54,44,254,230,253,32,65,207,122,128,48,86,215,103,96,253,179,89,244,147,119,16,96,222,221,99,242,185,232,156,139,226,185,88,58,
+23,55,168,24,238,130,193,139,86,148,66,173,124,109,221,161,98,148,154,192,27,91,132,152,99,12,161,25,148,185,16,148,63,131,46,207,
+197,225,151,47,67,164,14,216,33,4,218,162,150,211,39,9,104,110,135,181,251,51,252,244,92,44,163,162,107,11,104,184,46,12,119,188,
+199,130,228,6,187,211,165,59,236,14,2,121,87,80,33,142,143,168,13,27,80,24,9,77,8,253,169,234,98,51,15,90,170,225,41,34,
+77,118,228,215,46,194,82,55,37,121,15,141,68,88,87,194,238,68,67,112,93,168,136,246,38,194,218,221,185,54,222,51,57,167,110,39,
+128,11,84,36,98,87,250,116,170,20,4,7,11,75,144,84,223,162,78,188,126,9,14,113,136,231,118,136,92,160,106,123,70,113,119,42,
+221,1,224,246,12,24,111,149,133,253,151,239,240,191,219,175,12,225,248,183,227,4,73,231,162,171,224,72,137,243,190,116,216,44,191,199,
+124,222,219,13,33,204,43,156,137,219,123,183,33,100,249,12,137,118,98,194,186,233,59,252,23,187,185,33,196,254,26,255,105,123,7,98,
+94,108,147,180,48,23,156,32,60,76,40,96,70,24,91,194,3,108,11,61,28,100,250,6,112,183,132,30,96,106,224,83,65,244,145,53,
+33,245,137,90,181,232,161,162,7,88,34,122,128,57,70,8,184,232,193,163,7,88,103,172,213,27,224,120,20,62,25,80,58,68,143,45,
+194,190,141,176,199,236,7,15,242,163,240,19,28,5,134,104,108,35,26,81,97,31,17,11,54,142,30,96,232,232,1,214,126,143,205,33,
+14,168,22,127,40,161,178,135,10,14,24,24,88,246,194,26,72,100,37,200,93,81,93,46,172,11,149,83,23,215,168,134,10,107,182,23,
+253,242,63,239,127,98,115,88,92,128,85,113,152,77,124,49,191,124,217,68,177,54,138,156,94,57,1,62,252,13,103,72,4,154,124,163,
+203,104,66,228,207,239,192,132,228,48,45,37,9,224,71,24,178,223,63,14,191,15,211,209,32,143,201,97,17,185,37,44,178,254,136,91,
+7,240,156,225,224,239,89,20,86,31,129,154,228,123,71,7,235,197,197,162,96,34,255,118,119,151,50,193,49,7,96,218,97,114,132,82,
+77,32,7,66,57,193,19,138,144,40,38,187,216,17,102,44,129,3,127,134,236,3,197,164,145,212,144,191,9,229,17,137,46,108,107,199,
+79,88,85,231,40,220,180,146,85,136,230,206,14,123,8,189,67,135,45,95,122,217,11,215,42,3,191,192,188,26,147,110,167,248,71,152,
+233,135,218,90,188,97,46,137,215,115,20,119,223,174,32,223,216,221,85,35,82,245,171,138,104,3,11,234,254,226,137,197,211,241,68,242,
+46,17,109,52,71,229,171,131,140,100,22,254,221,37,194,237,139,226,93,184,33,156,184,220,17,62,157,108,68,7,25,9,18,35,73,145,
+78,103,73,2,195,49,2,127,200,166,233,92,1,21,8,92,123,32,69,28,203,166,41,42,247,64,165,25,134,194,242,15,121,44,239,62,
+228,163,87,120,230,69,212,131,162,24,44,174,65,32,28,201,50,33,22,192,141,65,41,15,15,130,76,176,240,51,23,14,20,183,162,90,
+248,121,68,187,40,136,160,248,28,101,180,165,18,253,76,252,151,249,95,222,233,239,27,70,38,46,54,255,222,136,224,189,239,249,198,90,
+32,88,208,2,83,189,196,127,249,243,143,107,7,249,153,251,67,206,42,84,96,61,12,110,76,100,146,16,65,75,225,254,4,82,64,249,
+74,237,122,239,227,4,225,233,109,206,124,202,239,145,205,160,77,125,89,250,222,127,172,69,89,115,209,70,22,168,21,55,191,136,15,94,
+87,117,57,252,140,198,198,183,254,239,88,148,116,221,65,224,128,140,70,188,130,212,66,179,190,154,121,188,50,94,126,41,121,187,174,197,
+32,23,31,31,222,174,30,239,190,253,124,234,226,205,200,197,155,200,197,107,224,98,196,216,33,151,192,131,10,200,131,202,23,190,145,14,
+125,163,120,81,147,69,190,177,116,229,27,55,200,5,69,140,67,193,189,22,249,183,136,133,152,22,214,160,137,95,12,118,31,186,153,147,
+4,77,212,134,216,85,138,28,137,112,37,209,218,133,68,175,5,82,130,80,7,12,21,9,4,138,72,173,79,43,47,138,118,186,68,14,
+203,115,57,176,26,50,157,163,115,240,147,204,82,15,52,250,59,206,129,169,193,27,150,195,114,59,170,193,136,15,68,154,192,41,12,64,
+49,60,157,47,0,48,70,238,192,224,176,184,30,213,133,38,70,106,4,41,198,149,24,249,16,55,60,144,187,135,124,2,70,10,91,30,
+98,20,232,111,163,16,82,64,164,25,58,11,200,168,44,243,64,97,212,3,229,82,209,27,6,111,59,162,65,228,142,137,46,145,7,35,
+53,240,52,142,147,88,190,193,0,202,6,145,63,158,132,29,58,44,152,214,39,30,43,134,140,34,44,8,206,152,83,77,228,190,174,170,
+98,47,6,117,103,55,22,219,154,21,217,154,137,54,186,34,173,185,22,214,165,112,250,255,93,225,144,192,91,242,22,199,180,7,226,255,
+134,208,18,183,164,198,17,36,240,189,128,253,90,68,20,18,228,255,231,178,104,189,174,184,152,133,57,79,31,237,53,35,167,39,70,30,
+26,252,222,241,113,24,250,189,82,81,68,118,40,128,176,204,251,15,86,108,235,162,248,139,197,251,106,61,248,170,111,212,211,106,74,230,
+113,123,127,151,128,188,91,85,81,116,4,139,166,0,73,49,44,161,142,8,17,251,249,146,129,109,170,79,232,0,52,147,197,116,174,220,
+31,5,120,187,174,90,37,248,211,27,79,181,234,84,133,146,129,126,84,230,108,169,139,158,251,64,202,180,17,0,59,47,55,103,115,168,
+43,243,6,188,206,90,195,90,107,170,79,2,40,151,123,92,185,203,85,185,134,88,69,175,127,235,79,38,187,88,159,202,71,170,29,150,
+203,251,62,206,227,93,220,36,28,163,148,181,197,198,161,63,85,241,124,215,37,151,205,76,214,86,167,71,175,75,81,219,161,65,56,193,
+2,239,6,123,146,9,218,7,25,250,201,65,247,224,101,45,168,7,92,174,112,44,84,17,188,65,116,171,44,180,193,127,110,42,187,176,
+80,25,205,45,147,201,228,243,217,22,46,224,93,183,125,144,242,48,206,144,221,251,46,119,244,170,195,99,79,45,237,251,89,192,237,2,
+141,136,14,158,63,230,241,254,161,224,194,24,248,228,40,13,17,189,10,238,14,9,74,16,91,135,126,83,196,69,85,198,93,62,75,109,
+155,6,177,12,104,138,41,145,148,48,173,237,83,162,79,110,243,27,194,113,109,34,199,59,100,103,136,230,82,221,251,235,249,49,159,31,
+31,123,60,208,188,134,57,54,3,114,139,175,137,37,14,243,235,34,90,73,210,9,116,162,147,215,137,110,105,69,116,114,237,194,142,109,
+51,94,223,207,247,151,100,102,71,9,169,129,220,160,83,45,131,238,118,156,84,198,181,240,60,237,100,229,114,147,236,165,242,121,63,191,
+194,123,68,135,234,210,126,137,37,202,136,185,109,106,52,158,24,221,82,183,207,170,213,65,73,29,118,217,18,94,47,15,135,157,114,48,
+108,85,74,195,42,91,26,242,108,105,151,101,75,65,183,82,82,155,149,82,179,94,10,114,163,74,64,18,44,223,206,103,115,165,97,169,
+84,157,27,173,81,181,54,149,123,142,107,206,140,28,158,179,198,123,210,91,206,55,156,126,236,16,98,127,48,146,251,221,114,103,64,18,
+149,94,206,217,205,8,199,42,153,120,155,202,164,38,243,122,106,223,154,111,214,100,155,238,152,173,28,189,195,247,99,142,174,101,76,109,
+211,91,216,99,186,63,26,182,181,41,252,99,213,41,107,113,240,175,100,213,74,219,218,16,254,181,203,255,243,109,61,97,192,20,26,118,
+42,227,147,75,96,107,42,91,27,171,190,55,238,56,7,201,49,130,124,131,36,220,108,77,208,252,96,98,11,245,67,141,111,151,134,157,
+222,200,83,29,81,82,51,156,229,6,115,103,223,247,164,188,229,200,123,74,31,49,133,32,103,178,222,180,235,116,220,170,211,158,239,89,
+38,149,105,25,182,210,175,172,25,106,185,206,237,246,123,41,51,208,8,57,199,102,221,229,161,39,102,185,109,185,183,28,248,133,186,199,
+246,150,133,192,53,109,202,115,36,78,60,114,185,194,78,82,243,243,221,161,32,58,253,154,108,209,155,178,228,146,172,71,29,148,141,224,
+83,121,193,28,29,51,141,114,78,46,179,203,45,205,245,42,221,214,112,21,12,29,201,234,102,120,170,71,204,237,173,179,105,251,134,178,
+8,28,112,9,65,110,157,25,44,143,122,144,211,196,172,152,155,101,119,13,178,224,58,83,124,208,237,211,195,213,180,46,144,125,163,91,
+213,119,147,108,142,220,27,141,220,82,219,18,123,146,14,148,204,202,99,243,89,142,89,213,212,163,40,141,82,25,147,163,69,106,159,203,
+143,196,22,87,203,241,91,38,229,180,115,250,188,93,21,84,115,182,63,100,43,68,106,78,186,153,195,146,153,51,237,129,206,101,141,192,
+49,216,222,176,230,240,124,190,193,102,231,219,202,246,184,203,28,244,160,83,17,39,202,114,169,172,251,75,5,111,89,219,89,77,108,205,
+186,189,76,181,166,145,70,215,180,243,35,189,53,25,229,246,4,158,75,85,100,202,86,77,46,175,215,43,156,103,10,100,46,183,245,51,
+204,106,57,48,12,97,104,45,253,227,113,193,247,143,53,254,64,239,38,165,174,127,16,243,107,215,219,46,82,114,230,104,22,180,60,171,
+23,216,114,157,39,140,138,15,206,77,158,155,153,108,87,159,53,83,194,46,175,79,20,182,156,233,211,199,128,206,88,74,137,247,179,45,
+110,74,207,242,203,201,190,194,174,83,85,101,182,106,246,136,110,153,12,104,203,106,181,170,246,161,213,103,171,235,209,54,191,116,171,237,
+81,123,63,174,79,11,154,55,91,77,11,246,142,96,133,195,196,20,93,5,15,90,78,149,53,188,221,182,150,18,7,243,61,89,112,38,
+42,62,173,87,199,199,73,142,162,5,170,223,217,30,87,93,150,41,116,59,211,113,225,152,153,251,174,2,28,35,250,245,85,159,99,39,
+213,108,169,60,171,121,3,178,212,116,179,107,110,92,31,170,179,74,111,41,208,114,170,66,11,132,190,58,174,157,66,215,223,102,228,236,
+124,98,209,41,211,207,121,78,143,148,230,4,33,175,54,89,95,217,29,83,210,210,203,201,29,54,155,106,16,180,207,247,199,83,163,153,
+47,224,246,129,239,51,44,177,99,244,46,167,110,29,191,51,146,100,188,111,102,215,142,209,44,193,204,185,233,90,92,76,109,78,239,141,
+86,74,99,176,167,253,101,144,31,84,52,158,218,233,133,221,146,41,224,83,193,19,251,101,77,25,77,179,211,225,60,227,120,202,172,122,
+20,171,109,142,219,215,230,158,164,14,248,140,154,25,175,156,140,214,41,129,7,228,84,111,222,219,43,13,126,86,199,221,86,118,138,183,
+105,23,22,220,128,28,230,231,110,208,219,47,156,9,161,241,185,178,43,233,13,107,125,24,229,234,115,109,176,47,76,143,227,137,178,158,
+76,44,119,214,223,57,44,19,12,26,236,52,213,173,44,102,62,189,217,143,157,138,64,245,108,129,81,155,174,181,101,43,221,42,175,45,
+187,218,218,35,75,244,186,39,31,87,172,178,98,204,245,122,220,232,7,59,141,83,141,9,19,244,106,252,64,95,54,218,74,189,172,59,
+29,97,86,176,148,202,238,232,73,53,210,57,244,202,243,46,37,176,68,139,12,218,134,46,180,112,146,42,108,151,186,32,7,244,178,111,
+154,20,23,108,102,245,78,169,51,48,75,199,189,236,184,185,170,107,242,181,6,29,184,5,53,75,107,91,183,215,144,171,71,190,118,160,
+103,30,46,174,212,195,82,99,236,134,85,230,188,101,129,227,75,132,66,141,152,182,74,241,83,178,203,241,153,185,119,160,21,110,226,150,
+244,188,63,206,29,173,38,55,238,19,139,84,127,164,246,149,86,179,147,2,77,207,225,165,118,42,147,106,187,229,54,155,161,234,222,60,
+183,18,157,148,78,183,243,86,10,194,96,198,236,83,125,174,169,75,211,178,26,184,181,161,51,150,115,229,169,55,7,147,30,117,88,142,
+39,240,221,164,189,217,152,174,63,202,153,155,227,176,53,145,56,142,156,151,124,117,234,108,172,234,118,115,100,88,99,50,183,39,37,215,
+109,58,189,86,74,58,84,27,27,157,247,186,202,122,55,170,187,131,160,49,99,230,147,114,219,60,104,236,112,96,106,100,201,162,199,86,
+193,26,241,252,100,219,46,51,244,160,197,215,204,114,179,70,73,253,64,32,184,122,137,16,179,51,146,73,141,230,149,177,176,155,81,248,
+42,179,61,218,90,99,158,135,229,176,82,232,186,180,227,21,114,46,200,175,176,21,235,53,107,58,170,15,21,147,15,182,213,253,34,111,
+22,178,163,217,161,57,47,84,140,89,101,180,52,189,186,43,205,203,253,12,177,164,123,27,177,51,29,250,107,111,237,179,188,149,202,109,
+135,28,81,231,185,190,85,146,38,126,189,95,201,86,245,76,189,214,28,141,197,74,214,17,234,46,195,207,106,173,193,184,121,108,27,150,
+215,167,103,101,219,224,136,210,136,238,251,157,148,195,12,183,158,192,110,234,76,213,41,231,21,119,208,156,102,123,6,147,106,215,134,68,
+51,181,48,241,74,155,164,198,27,46,155,97,212,114,119,220,55,106,227,122,190,196,14,197,109,62,59,156,58,45,251,160,151,134,46,107,
+226,140,218,18,71,222,176,203,248,141,78,7,199,217,96,94,161,149,218,97,85,102,245,249,124,165,88,77,194,99,240,64,104,13,89,3,
+119,6,195,105,77,53,189,22,95,89,152,135,246,118,211,43,179,174,91,227,181,85,111,102,57,86,158,47,140,183,212,126,211,109,250,165,
+252,168,204,233,227,186,234,77,92,202,237,16,59,153,203,42,67,193,28,26,235,54,223,25,119,247,37,85,106,242,163,117,109,185,98,103,
+227,222,50,59,90,184,249,113,155,157,185,155,156,151,178,219,155,125,62,203,250,124,203,102,1,85,125,60,247,214,56,168,210,140,16,231,
+26,215,173,110,143,205,124,163,85,246,249,97,143,220,141,118,2,219,74,141,92,77,238,102,169,254,126,201,45,43,107,107,91,1,79,141,
+215,91,229,114,125,45,138,3,117,11,139,210,188,80,118,155,135,150,149,202,46,103,93,81,156,85,167,5,206,105,46,118,243,242,193,168,
+7,162,189,230,22,135,197,2,119,77,55,235,59,155,108,127,144,219,231,251,59,82,218,137,1,41,239,23,84,85,235,52,28,97,183,78,
+81,246,81,32,7,185,57,174,109,57,117,191,90,214,100,126,62,235,79,184,117,149,223,173,232,131,119,232,168,21,124,213,208,131,130,215,
+235,181,55,61,118,154,91,83,135,142,209,155,23,154,245,58,49,156,109,22,86,137,235,109,218,22,93,209,228,69,185,73,207,218,199,78,
+161,215,236,106,26,15,108,226,157,101,161,163,5,221,173,54,54,133,213,36,35,145,184,77,84,106,91,71,233,114,35,219,159,246,88,110,
+184,231,134,198,180,77,72,203,49,190,203,53,10,160,14,186,190,108,45,250,93,111,183,176,201,30,201,230,44,207,27,246,202,169,18,223,
+50,141,67,126,220,91,84,230,229,149,165,151,237,193,188,83,214,187,219,109,190,178,212,196,234,161,75,140,91,157,124,70,53,92,46,147,
+3,127,179,27,173,89,33,67,165,230,214,100,59,104,14,182,45,176,177,46,49,101,57,214,93,112,131,93,37,43,109,156,130,67,7,205,
+150,181,86,83,131,230,118,59,145,148,89,73,106,115,194,65,232,119,115,188,214,44,117,26,140,103,219,235,145,217,233,234,147,213,180,175,
+230,247,179,238,112,41,149,108,2,239,243,60,189,231,155,163,146,235,115,92,181,185,28,192,124,115,194,212,10,166,91,53,187,219,43,37,
+111,102,149,140,185,159,33,22,7,240,225,172,193,13,11,94,137,237,112,70,103,217,223,40,236,190,57,174,176,148,201,242,254,162,215,244,
+204,130,56,108,44,91,102,110,182,234,111,119,133,182,103,249,74,105,107,148,54,249,249,176,228,154,211,163,44,30,172,30,177,102,83,213,
+126,118,49,107,137,249,217,96,64,168,204,150,11,118,249,30,207,108,83,173,229,20,223,50,174,23,176,109,189,44,117,178,86,215,157,219,
+222,184,50,104,87,253,35,159,130,184,0,121,46,31,42,102,70,109,86,225,168,250,144,96,14,198,174,157,107,58,135,165,101,173,117,5,
+223,146,229,81,159,159,247,157,102,201,96,5,155,196,247,246,184,217,86,5,122,187,216,246,184,254,82,204,13,69,117,49,42,109,106,138,
+108,213,54,195,86,102,98,48,74,67,71,39,77,220,218,177,182,221,210,130,60,93,17,236,28,159,110,189,133,59,194,71,11,99,62,243,
+212,237,220,234,59,141,174,98,181,185,94,106,51,229,43,181,33,44,122,219,227,164,109,141,183,37,97,90,152,142,97,113,206,54,121,58,
+88,6,138,104,215,58,205,42,227,108,221,224,80,110,18,59,189,87,49,97,165,231,143,12,172,178,124,86,208,51,180,208,238,176,126,155,
+15,234,1,55,152,29,114,155,67,169,176,92,216,211,46,87,34,70,188,171,83,82,111,212,218,31,6,126,53,80,203,52,49,37,234,10,
+61,220,81,7,110,233,225,109,181,179,91,78,134,70,171,111,244,87,245,210,168,83,226,202,110,202,219,54,203,198,150,176,41,135,99,216,
+194,164,179,203,216,142,95,21,122,249,37,184,169,9,163,212,118,195,202,162,60,245,9,115,42,87,247,5,98,102,128,127,94,83,14,163,
+84,232,201,108,177,45,240,234,65,174,76,213,185,92,155,101,179,7,155,119,204,214,112,190,202,148,235,187,105,201,105,150,115,74,147,104,
+143,236,81,175,63,208,135,243,133,46,78,234,50,219,171,121,220,60,197,13,58,118,71,59,210,196,126,102,17,218,4,20,165,165,78,59,
+57,109,191,79,5,246,12,223,14,143,243,101,201,205,89,38,24,74,87,238,90,57,200,21,154,170,23,112,188,15,108,217,26,68,185,170,
+182,150,106,103,200,205,26,188,228,150,247,70,118,154,221,245,152,154,66,109,230,16,127,116,83,75,201,91,81,45,111,86,153,183,92,77,
+159,74,186,93,89,170,236,212,118,136,14,221,174,47,170,139,205,236,120,104,16,140,219,109,45,74,164,103,147,155,82,109,85,94,183,75,
+77,111,93,51,165,90,233,48,88,15,130,236,108,195,204,231,13,117,48,131,133,32,160,90,107,150,201,241,13,88,115,186,131,138,95,26,
+141,173,73,69,103,248,202,14,100,84,169,211,92,89,41,175,173,50,177,83,70,6,185,130,252,111,52,45,179,217,234,108,216,25,5,229,
+17,195,183,15,182,191,245,171,91,174,36,186,214,234,48,101,243,7,163,175,182,32,251,195,247,94,169,231,116,171,61,149,158,226,224,180,
+121,167,221,107,214,6,246,68,105,202,189,44,153,109,29,71,115,97,162,169,138,177,117,42,41,67,80,135,139,202,84,24,30,251,65,217,
+117,212,193,148,13,90,59,143,85,150,199,173,136,215,59,11,163,145,133,40,108,219,95,85,200,221,102,179,245,143,19,218,246,116,86,206,
+245,182,100,206,169,243,29,179,93,89,65,112,68,150,140,150,156,175,205,90,153,76,118,55,79,57,25,41,192,51,148,185,84,197,131,100,
+214,133,138,151,35,148,250,182,162,206,96,145,174,174,205,149,128,179,124,141,205,232,4,219,221,224,7,35,160,172,238,172,54,94,148,142,
+53,179,180,61,206,231,185,245,42,51,103,228,156,127,44,181,178,35,60,211,223,173,246,75,107,72,25,141,145,223,144,29,255,32,84,202,
+150,162,146,188,141,91,1,231,121,82,89,168,173,189,84,197,157,173,2,174,73,42,187,93,129,234,117,90,27,106,84,117,91,205,85,70,
+28,77,92,51,103,216,228,200,24,101,236,2,211,224,85,194,26,174,120,106,78,52,199,181,114,137,40,88,237,163,208,153,11,149,30,206,
+151,118,117,75,155,173,87,203,253,62,75,149,218,78,170,96,115,90,245,88,42,243,153,86,45,197,44,235,100,37,53,219,123,222,102,164,
+104,100,165,39,43,173,62,225,240,195,106,155,45,55,235,76,75,23,202,220,152,240,113,171,84,174,183,90,149,58,53,7,119,181,218,138,
+228,182,107,141,97,161,244,142,92,153,168,237,130,169,205,180,71,122,176,169,247,60,136,163,8,223,42,247,15,35,155,132,128,97,202,151,
+228,205,106,86,54,45,122,197,244,167,212,38,192,199,185,89,103,193,51,98,187,86,17,185,172,78,168,30,215,60,150,21,109,196,123,206,
+88,170,233,7,51,167,246,120,89,145,230,236,104,145,43,195,90,91,128,72,34,43,153,202,132,158,174,52,185,167,88,38,179,76,205,251,
+43,224,182,85,154,122,238,100,48,169,218,96,218,107,67,231,39,86,125,102,58,237,146,95,237,184,195,198,193,174,115,122,119,32,136,7,
+103,103,213,137,85,117,64,172,2,197,173,229,131,253,198,166,251,41,95,56,52,115,56,179,183,220,163,38,214,117,127,38,236,43,125,122,
+109,209,204,97,95,83,120,23,80,116,23,78,119,40,210,171,166,167,145,44,61,242,220,165,212,93,87,218,115,133,101,228,137,216,27,48,
+135,58,63,48,89,113,72,172,92,210,168,35,255,191,157,6,126,192,55,43,210,110,193,147,123,221,33,164,57,119,132,156,196,168,203,125,
+113,83,168,28,14,76,189,180,236,230,41,113,222,30,19,123,94,205,15,230,222,126,69,247,105,171,172,118,241,28,223,45,244,148,172,209,
+181,136,99,201,206,86,33,51,53,72,88,20,233,61,53,243,6,156,230,150,11,78,22,183,23,144,244,18,59,183,66,151,7,100,106,204,
+76,32,157,49,167,133,90,213,163,199,171,78,174,103,7,22,238,168,219,246,66,17,122,230,84,218,246,192,3,173,86,6,91,167,38,211,
+178,92,225,90,135,101,75,14,248,93,99,180,91,16,21,89,89,244,201,114,126,167,87,112,161,61,98,142,148,175,13,152,133,68,119,112,
+94,84,182,138,50,29,100,102,218,104,223,27,147,244,214,206,148,234,173,131,73,78,20,123,47,117,184,214,228,184,152,207,23,165,125,93,
+206,149,170,217,252,186,87,18,235,91,38,216,149,217,225,102,5,201,205,144,224,8,163,105,239,245,113,94,118,196,163,208,179,117,159,222,
+106,199,246,182,32,30,151,22,85,94,107,246,96,188,131,184,202,88,239,2,118,43,154,130,209,31,80,16,146,29,245,131,156,178,216,90,
+182,41,152,173,65,135,45,4,227,253,52,99,151,250,162,64,40,65,205,247,23,234,152,15,204,142,44,120,11,178,108,76,38,118,161,212,
+246,2,201,238,244,122,206,160,222,210,11,121,198,94,87,76,62,99,28,155,85,136,133,235,92,141,219,177,219,212,104,216,36,82,187,96,
+86,234,184,205,202,177,156,235,87,26,213,160,58,102,136,225,122,74,168,85,53,215,222,85,22,251,118,78,226,6,13,179,185,208,14,19,
+136,5,234,249,234,6,15,182,117,157,156,144,92,134,10,74,133,241,146,204,230,196,242,182,208,196,55,135,2,100,224,81,236,14,68,184,
+153,156,68,217,56,209,43,5,213,146,182,197,153,198,156,11,70,173,121,174,20,4,84,165,166,24,134,218,210,185,177,54,103,137,182,54,
+225,58,99,175,63,207,100,130,17,213,35,205,201,180,91,174,86,55,147,102,138,218,7,157,238,160,116,28,180,15,155,236,194,43,48,243,
+227,116,107,44,149,77,185,101,146,114,167,85,96,50,194,156,96,54,157,163,65,30,85,101,146,219,42,25,217,145,26,34,65,238,26,25,
+67,22,23,84,129,114,53,128,163,203,116,55,179,75,25,98,222,113,251,227,77,170,27,224,148,98,249,189,154,203,80,27,3,39,228,70,
+110,89,165,134,3,186,89,175,25,13,162,198,55,167,142,152,217,246,105,129,119,130,212,18,92,226,112,183,146,120,69,233,208,187,160,48,
+223,5,171,92,33,163,139,74,161,148,210,240,249,118,114,36,186,29,150,15,118,29,74,94,205,93,135,24,44,253,253,202,41,151,32,200,
+54,43,246,108,151,115,185,197,102,151,201,8,99,59,227,230,54,10,53,113,243,20,61,98,220,138,200,183,85,177,61,158,21,152,157,70,
+77,201,84,138,106,16,187,142,31,204,179,190,72,55,148,212,196,166,10,3,35,187,94,214,216,108,167,60,54,157,242,140,110,240,110,143,
+163,140,137,155,57,246,169,54,51,51,142,153,192,80,181,113,77,167,61,167,50,237,58,90,94,212,217,25,104,119,222,94,17,146,35,22,
+118,93,130,111,214,65,75,14,206,96,52,193,247,115,94,51,187,244,170,157,217,79,90,214,132,80,142,236,49,191,104,7,195,206,152,36,
+104,41,223,59,64,80,120,44,24,179,156,217,206,206,42,70,191,91,147,179,19,194,98,5,103,183,244,152,169,229,169,48,238,216,172,175,
+216,124,131,21,13,6,2,250,195,70,100,202,115,72,46,25,109,90,211,198,245,182,43,182,82,129,218,170,176,211,109,202,104,178,144,199,
+245,248,62,63,6,231,147,105,181,5,187,220,105,191,110,203,86,74,10,36,1,132,52,37,178,189,90,110,50,77,45,149,109,161,188,98,
+26,190,56,229,137,130,151,35,77,17,111,23,86,141,93,126,189,242,11,32,249,118,71,58,18,91,60,159,107,240,187,44,189,239,10,90,
+166,231,240,244,104,190,242,15,199,220,158,56,234,18,183,47,48,219,38,238,24,117,97,214,192,243,253,238,178,115,232,57,237,125,181,202,
+45,182,150,13,2,154,27,115,156,31,115,27,77,51,164,126,207,81,216,195,193,109,241,155,186,148,203,50,198,182,215,105,31,167,85,203,
+211,148,1,87,171,75,60,158,221,123,203,45,81,175,23,248,198,190,53,62,178,129,218,175,26,227,44,81,27,170,29,139,231,136,190,220,
+61,140,179,227,26,219,109,11,248,100,206,14,213,145,118,148,213,25,63,174,179,110,125,209,13,214,173,44,63,154,27,222,210,215,14,186,
+53,170,173,155,157,49,221,167,234,25,161,147,119,242,68,176,110,103,249,25,228,224,99,127,114,224,14,156,182,60,102,9,198,2,155,179,
+249,205,118,177,144,196,22,155,239,176,7,95,163,102,16,138,50,185,214,124,212,233,250,193,214,90,248,243,130,187,228,160,29,239,148,219,
+43,97,22,144,131,38,158,159,110,171,156,180,148,246,36,208,226,176,1,187,94,174,178,14,110,56,237,22,207,26,62,227,186,174,222,25,
+168,157,67,161,132,79,184,1,205,148,32,138,108,216,198,114,75,235,242,166,208,36,74,235,142,42,23,86,132,194,11,188,188,169,251,205,
+54,181,239,206,114,139,117,65,34,120,98,59,93,206,204,234,104,153,106,24,203,86,127,143,115,155,77,131,235,153,98,181,186,88,8,205,
+217,238,32,185,125,93,112,3,181,83,26,118,199,212,132,171,180,119,99,191,153,55,236,131,57,217,89,41,162,93,147,106,230,178,52,108,
+177,71,9,135,52,190,199,28,235,21,169,221,238,146,117,219,173,59,135,225,130,12,178,108,202,205,110,185,161,80,207,225,16,60,17,173,
+81,106,10,189,119,11,101,163,142,141,85,80,163,151,27,106,218,16,26,246,114,115,172,169,2,240,122,237,246,70,99,161,162,30,57,187,
+110,84,217,122,173,39,136,62,217,118,15,78,191,191,245,237,138,153,213,8,77,107,115,126,143,86,185,42,183,148,192,158,42,67,117,215,
+17,237,236,145,176,15,153,81,205,175,106,147,10,235,110,101,183,181,50,180,234,104,193,178,221,221,113,143,183,143,71,45,165,85,167,52,
+47,236,57,234,184,234,108,151,45,191,188,202,85,198,6,62,211,232,146,225,56,135,32,181,104,232,100,203,240,235,102,135,235,6,100,179,
+209,86,142,189,89,223,48,230,155,246,128,237,118,244,221,200,11,6,100,191,170,141,181,106,106,71,243,195,236,126,183,108,18,213,250,104,
+177,27,106,182,82,93,102,27,2,191,229,186,93,186,110,81,187,249,162,151,179,7,146,176,217,111,155,45,129,110,215,186,125,161,158,202,
+47,217,10,233,29,244,106,111,144,175,31,113,71,154,44,104,163,159,91,229,20,171,176,97,201,146,250,193,23,144,38,107,210,65,106,179,
+154,142,26,100,143,154,172,134,225,39,144,214,104,74,87,157,117,75,85,213,98,241,46,33,24,94,241,238,245,183,217,15,28,235,238,124,
+0,67,181,194,95,225,20,29,1,136,62,145,11,241,71,113,235,47,159,134,186,58,89,21,31,210,74,92,94,248,189,113,104,32,60,218,
+100,189,158,112,18,194,227,141,209,149,135,240,43,246,15,243,231,253,115,169,88,44,38,209,135,176,240,59,182,240,93,120,61,151,35,68,
+159,180,209,215,49,15,30,95,190,36,35,178,47,240,160,79,218,250,163,135,89,111,14,39,96,168,239,213,119,186,206,233,74,0,250,238,
+102,21,239,2,247,49,147,185,75,189,94,95,64,191,169,13,1,166,53,203,245,82,119,153,64,94,186,33,47,3,247,46,60,160,235,96,
+206,190,31,254,110,150,226,3,17,214,136,197,231,215,79,122,143,191,17,241,111,61,187,187,195,162,211,13,97,85,124,54,8,213,198,7,
+6,46,138,241,213,139,240,184,242,75,124,196,217,219,207,116,83,178,130,34,137,103,243,152,183,31,250,178,47,163,99,250,222,190,106,162,
+95,145,232,132,135,182,209,81,162,248,61,164,197,219,143,209,65,8,28,192,74,104,240,176,52,209,55,114,17,191,184,146,179,31,248,27,
+59,58,151,143,14,120,59,105,71,22,164,195,24,93,64,186,15,15,183,199,227,197,231,139,209,57,165,8,111,177,24,227,253,243,207,184,
+234,33,174,248,246,237,27,126,159,138,251,161,175,156,230,215,226,105,14,247,79,231,67,190,39,204,144,199,41,94,242,254,41,70,28,61,
+82,94,218,68,136,78,52,87,208,121,117,211,10,64,216,78,218,149,77,16,109,218,5,113,2,243,155,72,35,119,130,17,159,144,141,250,
+255,246,74,223,151,47,231,190,15,17,182,111,164,76,133,51,137,24,19,245,192,78,188,184,127,185,199,104,28,191,127,18,220,131,41,38,
+46,238,245,156,105,23,163,67,102,105,207,209,55,64,250,221,29,26,47,60,196,229,218,134,238,37,51,255,229,124,255,47,51,115,255,122,
+212,54,233,21,191,157,38,28,30,210,125,118,209,249,243,199,87,25,166,229,240,9,26,27,179,250,5,29,40,62,209,132,201,73,28,139,
+7,45,130,186,136,247,151,183,157,246,241,73,31,116,169,38,212,5,100,246,72,227,188,228,73,67,191,226,223,173,71,43,117,247,61,250,
+101,66,197,187,212,169,5,49,116,169,155,130,115,152,160,223,121,118,39,160,131,214,75,95,81,208,177,83,39,109,153,150,45,155,151,151,
+187,94,229,116,82,171,136,182,87,197,71,135,193,197,51,233,47,33,18,209,176,92,249,18,203,187,78,4,234,4,244,32,1,89,62,162,
+60,158,21,70,203,84,140,37,62,57,123,117,62,28,52,55,58,58,135,126,241,136,135,126,227,164,165,68,167,197,203,225,36,206,183,60,
+16,103,64,23,4,78,151,131,184,207,235,53,153,157,165,75,161,5,152,232,10,208,84,55,189,124,18,191,255,254,170,35,175,213,20,153,
+36,176,223,240,251,27,138,249,170,64,143,228,91,68,160,26,175,190,226,29,170,84,150,44,100,11,76,142,44,48,255,186,108,164,81,35,
+8,250,212,243,91,17,191,192,147,42,190,215,157,104,78,167,219,41,177,96,98,215,146,42,70,205,136,205,98,124,220,234,207,63,175,64,
+98,239,147,118,69,199,50,140,137,133,174,83,220,108,106,132,135,39,0,83,36,22,25,93,82,250,165,112,95,94,46,20,21,83,147,201,
+208,190,34,155,117,14,207,66,32,232,94,226,218,230,46,44,46,106,86,208,175,107,75,94,248,226,7,93,186,187,71,183,36,72,28,15,
+47,168,128,10,120,190,27,31,134,137,123,121,233,149,139,144,61,197,86,20,187,96,144,196,169,136,200,59,29,204,120,1,157,5,207,47,
+134,183,181,208,240,150,33,163,91,198,232,146,19,24,101,232,92,117,204,125,122,189,157,246,251,239,241,85,136,98,56,25,226,203,249,146,
+203,151,47,50,200,88,7,147,5,226,174,157,6,58,55,122,13,72,98,238,9,240,116,182,244,5,251,33,98,48,24,102,96,239,216,27,
+137,176,248,219,169,20,138,227,29,84,140,41,114,26,87,237,39,119,226,105,186,27,29,168,141,20,6,160,192,89,61,71,39,206,239,66,
+166,174,101,32,208,72,190,237,127,194,125,3,195,165,133,178,63,188,239,119,190,25,250,249,187,199,59,228,254,238,126,158,238,51,188,81,
+176,162,119,66,1,138,255,243,36,19,100,185,97,172,145,128,69,14,156,191,27,189,61,255,30,223,160,0,106,126,187,62,102,123,186,39,
+17,94,164,136,175,89,201,23,23,62,146,86,82,78,159,175,96,160,227,131,231,198,115,57,29,222,2,187,132,188,192,18,30,28,134,70,
+116,61,231,199,207,251,151,36,226,3,6,241,73,200,143,19,109,69,239,229,247,119,84,133,0,191,167,95,239,2,253,240,126,162,117,244,
+70,53,194,124,82,181,120,233,48,163,139,143,175,166,129,78,240,74,50,184,5,116,100,232,129,136,150,34,57,92,137,68,112,10,64,209,
+203,203,239,224,49,144,44,208,173,14,243,41,30,8,234,128,19,38,240,28,135,78,241,101,91,144,53,58,209,116,114,34,104,81,139,201,
+58,95,21,66,46,254,140,35,188,94,115,3,6,141,27,17,233,248,34,136,24,141,239,250,182,236,128,249,87,35,102,121,88,7,107,97,
+34,246,252,2,176,201,231,232,34,202,227,107,8,6,47,177,94,148,15,77,41,25,222,63,6,205,0,11,125,250,199,63,190,102,78,55,
+144,191,102,226,123,202,153,232,255,32,245,191,1,206,139,106,239,82,106,0,0
 };
 
 #endif
@@ -0,0 +1,67 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+// Minimal stand-in for the Arduino core so the watchdog logic compiles on
+// the host. Only what the shared sources and headers touch is provided,
+// pin access goes through Hal.
+
+#ifndef _SIM_ARDUINO_H_INCLUDED_
+#define _SIM_ARDUINO_H_INCLUDED_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#define LOW               0x0
+#define HIGH              0x1
+
+#define INPUT             0x01
+#define OUTPUT            0x02
+#define INPUT_PULLUP      0x05
+
+#define RISING            0x01
+#define FALLING           0x02
+#define CHANGE            0x03
+
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+
+class String : public std::string
+{
+public:
+  String() { }
+  String(const char* s) : std::string(s) { }
+  String(const std::string& s) : std::string(s) { }
+};
+
+inline void yield() { }
+
+#endif // _SIM_ARDUINO_H_INCLUDED_
@@ -0,0 +1,178 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+// Microbenchmark for the in-memory log. Compares the byte arena MemLogger
+// with the former CircularBuffer<std::string,128> implementation and counts
+// heap allocations per logged message by hooking the global operator new.
+
+#include <Arduino.h>
+
+#include <stdlib.h>
+#include <new>
+#include <chrono>
+#include <CircularBuffer.h>
+
+#include <MemLogger.h>
+#include <LogBench.h>
+
+static unsigned long s_allocations = 0;
+
+void* operator new(size_t size)
+{
+  s_allocations++;
+  void* ptr = malloc(size ? size : 1);
+  if(!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+  free(ptr);
+}
+
+unsigned long heapAllocations()
+{
+  return s_allocations;
+}
+
+// the logger as it was before, minus returning a dangling pointer
+class LegacyLogger
+{
+public:
+  void logMessage(std::string message)
+  {
+    m_buffer.push(message);
+  }
+  size_t popLog(char* out, size_t size)
+  {
+    std::string cur("");
+    cur.reserve(1024);
+    while(m_buffer.size())
+      cur.insert(0, m_buffer.pop().c_str());
+    size_t len = cur.size() < size - 1 ? cur.size() : size - 1;
+    memcpy(out, cur.c_str(), len);
+    out[len] = '\0';
+    return len;
+  }
+private:
+  CircularBuffer<std::string,128> m_buffer;
+};
+
+typedef struct
+{
+  double secs;
+  unsigned long allocations;
+  unsigned long held;
+  unsigned long bytesPerRecord;
+  unsigned long bytesRead;
+} BenchResult;
+
+// logs messages shaped like the cooldown message SanityChecker emits once a
+// second, including formatting them where the caller has to, then reads the
+// whole log back once
+template <typename LOG, typename READ>
+static BenchResult runOne(unsigned long messages, LOG log, READ read)
+{
+  BenchResult result = { 0, 0, 0, 0, 0 };
+
+  unsigned long allocations = s_allocations;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(unsigned long i = 0; i < messages; i++)
+    log(i);
+  result.secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  result.allocations = s_allocations - allocations;
+
+  char out[2048];
+  size_t len;
+  while((len = read(out, sizeof(out))) > 0)
+    result.bytesRead += len;
+  return result;
+}
+
+static void formatCooldown(char* buf, size_t size, unsigned long i)
+{
+  snprintf(buf, size, "=SC:[%02lu:%02lu:%02lu.%03lu] Cooldown active for another %lu seconds\n",
+    i / 3600, (i / 60) % 60, i % 60, 0ul, 120 - i % 120);
+}
+
+static void report(const char* name, unsigned long messages, const BenchResult& result)
+{
+  printf("%-8s %14.0f %12.2f %12lu %12lu %12lu\n", name, result.secs > 0 ? messages / result.secs : 0.0,
+    (double)result.allocations / messages, result.bytesPerRecord, result.held, result.bytesRead);
+}
+
+void runLogBench(unsigned long messages)
+{
+  printf("%lu messages, arena %d bytes\n\n", messages, MEMLOGGER_ARENA_SIZE);
+  printf("%-8s %14s %12s %12s %12s %12s\n", "logger", "msgs/s", "allocs/msg", "bytes/rec", "records held", "bytes read");
+
+  LegacyLogger* legacy = new LegacyLogger();
+  BenchResult result = runOne(messages,
+    [legacy](unsigned long i) { char buf[256]; formatCooldown(buf, sizeof(buf), i); legacy->logMessage(buf); },
+    [legacy](char* out, size_t size) { return legacy->popLog(out, size); });
+  // a std::string object plus its heap block
+  result.bytesPerRecord = sizeof(std::string) + 80;
+  result.held = 128;
+  report("legacy", messages, result);
+  delete legacy;
+
+  MemLogger* logger = MemLogger::instance();
+  uint32_t cursor = logger->lastSeq();
+  result = runOne(messages,
+    [logger](unsigned long i) { char buf[256]; formatCooldown(buf, sizeof(buf), i); logger->logMessage(buf); },
+    [logger, &cursor](char* out, size_t size) { return logger->readSince(cursor, out, size); });
+  result.held = logger->records();
+  result.bytesPerRecord = logger->bytesUsed() / result.held;
+  report("text", messages, result);
+
+  // binary events, formatted only when read back
+  cursor = logger->lastSeq();
+  result = runOne(messages,
+    [logger](unsigned long i) { logger->logEvent(LOGMSG_SC_COOLDOWN, 120 - i % 120); },
+    [logger, &cursor](char* out, size_t size) { return logger->readSince(cursor, out, size); });
+  result.held = logger->records();
+  result.bytesPerRecord = logger->bytesUsed() / result.held;
+  report("event", messages, result);
+
+  // ISR path: only an id and arguments are queued, iterate() moves them into
+  // the log and has to run before the small queue overflows
+  cursor = logger->lastSeq();
+  result = runOne(messages,
+    [logger](unsigned long i) {
+      MemLogger::logFromIsr(LOGMSG_FLASH_BUTTON, i);
+      if((i + 1) % (MEMLOGGER_ISR_QUEUE_SIZE / 2) == 0)
+        logger->iterate();
+    },
+    [logger, &cursor](char* out, size_t size) { return logger->readSince(cursor, out, size); });
+  result.held = logger->records();
+  result.bytesPerRecord = logger->bytesUsed() / result.held;
+  report("isr", messages, result);
+}
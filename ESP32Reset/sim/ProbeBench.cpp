@@ -0,0 +1,310 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+// Liveness probe benchmark. Three targets on 127.0.0.1 are watched by the
+// real ProbeScheduler and SanityChecker, combined by AND, OR and 2-of-3.
+// Loopback stand-ins play the target: a UDP heartbeat sender, an HTTP
+// health endpoint that can answer 503 or hang, and the kernel answering
+// pings. The phases take the probes down one after the other and the table
+// shows which rule declared a lockup, how fast and how often. Wall time
+// drives the virtual clock of SimHal.
+
+#include <Arduino.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <chrono>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <ConfigManager.h>
+#include <SanityChecker.h>
+#include <ProbeScheduler.h>
+#include <PulseEngine.h>
+#include <MemLogger.h>
+#include <Metrics.h>
+#include <SimHal.h>
+#include <ProbeBench.h>
+
+#define BENCH_TARGETS       3
+#define BENCH_UDP_PORT      42100 // + target
+#define BENCH_INTERVAL      250   // ms between heartbeats, pings and health checks
+#define BENCH_TIMEOUT       1000  // ms a probe stays up after its last success
+#define BENCH_COOLDOWN      1000
+#define BENCH_SKIP          16    // every so many heartbeats one is not sent
+#define BENCH_MAX_HUNG      64
+
+typedef enum : uint8_t
+{
+  HTTP_OK = 0,
+  HTTP_UNAVAILABLE,
+  HTTP_HANG,
+  MAXHTTPMODES
+} HTTP_MODE;
+
+typedef struct
+{
+  const char* name;
+  bool udp;
+  HTTP_MODE http;
+} Phase;
+
+static const Phase s_phases[] = {
+  { "healthy",          true,  HTTP_OK },
+  { "udp lost",         false, HTTP_OK },
+  { "udp lost, 503",    false, HTTP_UNAVAILABLE },
+  { "udp lost, hung",   false, HTTP_HANG },
+  { "healthy again",    true,  HTTP_OK }
+};
+
+static const char* s_rules[BENCH_TARGETS] = { "AND", "OR", "2-of-3" };
+
+// the target side on loopback, serviced without blocking
+class ProbeStandIn
+{
+public:
+  ProbeStandIn() : m_udp(-1), m_listen(-1), m_hung(0), m_seq(0), m_unsent(0), m_next(0) { }
+
+  // returns the port of the health endpoint, 0 on failure
+  uint16_t open()
+  {
+    m_udp = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    m_listen = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if(m_udp < 0 || m_listen < 0)
+      return 0;
+    int yes = 1;
+    setsockopt(m_listen, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+    sockaddr_in addr = loopback(0);
+    socklen_t len = sizeof(addr);
+    if(bind(m_listen, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(m_listen, 16) != 0 ||
+       getsockname(m_listen, (sockaddr*)&addr, &len) != 0)
+      return 0;
+    fcntl(m_listen, F_SETFL, fcntl(m_listen, F_GETFL, 0) | O_NONBLOCK);
+    return ntohs(addr.sin_port);
+  }
+
+  void close()
+  {
+    hangUp();
+    if(m_udp >= 0)
+      ::close(m_udp);
+    if(m_listen >= 0)
+      ::close(m_listen);
+  }
+
+  void service(unsigned long now, const Phase& phase)
+  {
+    if(phase.http != HTTP_HANG)
+      hangUp();
+    if((long)(now - m_next) >= 0)
+    {
+      m_next = now + BENCH_INTERVAL;
+      m_seq++;
+      if(!phase.udp || m_seq % BENCH_SKIP == 0)
+        m_unsent += BENCH_TARGETS;
+      else
+      {
+        char data[16];
+        int n = snprintf(data, sizeof(data), "%u", m_seq);
+        for(int t = 0; t < BENCH_TARGETS; t++)
+        {
+          sockaddr_in to = loopback(BENCH_UDP_PORT + t);
+          sendto(m_udp, data, n, 0, (sockaddr*)&to, sizeof(to));
+        }
+      }
+    }
+    int fd;
+    while((fd = accept(m_listen, NULL, NULL)) >= 0)
+    {
+      if(phase.http == HTTP_HANG && m_hung < BENCH_MAX_HUNG)
+      {
+        m_hungFds[m_hung++] = fd;
+        continue;
+      }
+      // the request is in by the time the status line matters to the prober
+      const char* answer = phase.http == HTTP_OK ? "HTTP/1.0 200 OK\r\n\r\n" : "HTTP/1.0 503 Service Unavailable\r\n\r\n";
+      send(fd, answer, strlen(answer), MSG_NOSIGNAL);
+      ::close(fd);
+    }
+  }
+
+  uint32_t unsent() const { return m_unsent; }
+
+private:
+  static sockaddr_in loopback(uint16_t port)
+  {
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return addr;
+  }
+
+  void hangUp()
+  {
+    for(int i = 0; i < m_hung; i++)
+      ::close(m_hungFds[i]);
+    m_hung = 0;
+  }
+
+  int m_udp;
+  int m_listen;
+  int m_hungFds[BENCH_MAX_HUNG];
+  int m_hung;
+  uint32_t m_seq;
+  uint32_t m_unsent;
+  unsigned long m_next;
+};
+
+void runProbeBench(unsigned long phaseSeconds)
+{
+  BoardConfig* boardcfg = reinterpret_cast<BoardConfig*>(ConfigManager::instance()->getConfig(CONFIG_TYPE::BOARD));
+  SimHal* hal = static_cast<SimHal*>(Hal::instance());
+  ProbeStandIn standIn;
+  uint16_t httpPort = standIn.open();
+  if(!httpPort)
+  {
+    printf("cannot open the loopback stand-ins: %s\n", strerror(errno));
+    return;
+  }
+
+  // pings need a raw socket, without one the rules run on two probes
+  int raw = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
+  uint8_t probes = PROBE_BIT(PROBE_UDP) | PROBE_BIT(PROBE_HTTP);
+  if(raw >= 0)
+  {
+    probes |= PROBE_BIT(PROBE_ICMP);
+    close(raw);
+  }
+  else
+    printf("no raw socket (%s), ICMP is left out and 2-of-3 becomes 2-of-2\n\n", strerror(errno));
+
+  boardcfg->targetCount = BENCH_TARGETS;
+  for(int t = 0; t < BENCH_TARGETS; t++)
+  {
+    TargetConfig& target = boardcfg->targets[t];
+    target.heartBeatPin = PIN_UNUSED;
+    target.powerWatchPin = PIN_UNUSED;
+    target.cooldownTime = BENCH_COOLDOWN;
+    // detection only; a recovery waveform would hold the target for 6 s
+    // and the waveforms of several targets are played one after the other
+    target.enabled = false;
+    target.probes = probes;
+    target.quorum = t == 0 ? 0 : t; // all, one, two
+    target.probeAddress = htonl(INADDR_LOOPBACK);
+    target.udpPort = BENCH_UDP_PORT + t;
+    target.httpPort = httpPort;
+    target.httpPath = "/health";
+    target.probeInterval = BENCH_INTERVAL;
+    target.udpTimeout = BENCH_TIMEOUT;
+    target.icmpTimeout = BENCH_TIMEOUT;
+    target.httpTimeout = BENCH_TIMEOUT;
+  }
+
+  ProbeScheduler* scheduler = ProbeScheduler::instance();
+  SanityChecker* checker = SanityChecker::instance();
+  scheduler->begin(SanityChecker::probeOk);
+  hal->reset(0);
+  checker->init(0);
+  for(int t = 0; t < BENCH_TARGETS; t++)
+  {
+    uint8_t running = scheduler->configure(t, boardcfg->targets[t]);
+    if(running != (probes & ~PROBE_BIT(PROBE_GPIO)))
+      printf("target %d: not all probes started, is UDP port %d taken?\n", t, BENCH_UDP_PORT + t);
+    SanityChecker::probesStarted(t, running);
+  }
+
+  printf("interval %d ms, probe timeout %d ms, %lu s per phase\n\n", BENCH_INTERVAL, BENCH_TIMEOUT, phaseSeconds);
+  printf("%-16s %6s %6s %6s", "phase", "udp", "icmp", "http");
+  for(int t = 0; t < BENCH_TARGETS; t++)
+    printf(" %14s", s_rules[t]);
+  printf(" %12s\n", "iterate max");
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  unsigned long phaseStart = 0;
+  for(size_t p = 0; p < sizeof(s_phases) / sizeof(s_phases[0]); p++)
+  {
+    const Phase& phase = s_phases[p];
+    uint32_t lockups[BENCH_TARGETS];
+    unsigned long firstLockup[BENCH_TARGETS];
+    for(int t = 0; t < BENCH_TARGETS; t++)
+    {
+      lockups[t] = checker->lockups(t);
+      firstLockup[t] = SIM_NEVER;
+    }
+    double maxIterate = 0;
+    unsigned long now = phaseStart;
+    while(now < phaseStart + phaseSeconds * 1000)
+    {
+      now = 1 + std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+      hal->advanceTo(now);
+      standIn.service(now, phase);
+
+      // never waits, everything it does is on non-blocking sockets
+      std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+      scheduler->iterate(now, 0);
+      double took = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - before).count();
+      if(took > maxIterate)
+        maxIterate = took;
+
+      PulseEngine::instance()->iterate();
+      checker->iterate(now);
+      MemLogger::instance()->iterate();
+      for(int t = 0; t < BENCH_TARGETS; t++)
+        if(firstLockup[t] == SIM_NEVER && checker->lockups(t) != lockups[t])
+          firstLockup[t] = now - phaseStart;
+      usleep(1000);
+    }
+    printf("%-16s %6s %6s %6s", phase.name, phase.udp ? "up" : "down",
+      probes & PROBE_BIT(PROBE_ICMP) ? "up" : "-",
+      phase.http == HTTP_OK ? "up" : phase.http == HTTP_UNAVAILABLE ? "503" : "hung");
+    for(int t = 0; t < BENCH_TARGETS; t++)
+    {
+      char cell[32];
+      if(firstLockup[t] == SIM_NEVER)
+        snprintf(cell, sizeof(cell), "alive");
+      else
+        snprintf(cell, sizeof(cell), "down %.2fs x%u", firstLockup[t] / 1000.0, (unsigned)(checker->lockups(t) - lockups[t]));
+      printf(" %14s", cell);
+    }
+    printf(" %10.0fus\n", maxIterate);
+    phaseStart = now;
+  }
+
+  MetricsSnapshot snap;
+  Metrics::instance()->snapshot(snap);
+  printf("\nprobe successes %u, failures %u, udp heartbeats lost %u of %u not sent\n",
+    snap.counters[METRIC_PROBE_SUCCESSES], snap.counters[METRIC_PROBE_FAILURES],
+    snap.counters[METRIC_UDP_HEARTBEATS_LOST], standIn.unsent());
+  scheduler->stop();
+  standIn.close();
+}
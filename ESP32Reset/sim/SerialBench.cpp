@@ -0,0 +1,409 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+// Throughput benchmark for the WebSerial output path. Replays a console
+// burst as it arrives over the UART at 1.5 Mbaud and sends it to one client
+// that keeps up and one that only empties its queue every 50 ms, both with
+// the queue limit of the firmware. The former path sent a frame per line
+// and copied it per client, the current one collects frames in
+// WebSerialBuffer and shares them between clients.
+
+#include <Arduino.h>
+#include <Constants.h>
+
+#include <chrono>
+
+#include <WebSerialBuffer.h>
+#include <LogBench.h>
+#include <SerialBench.h>
+
+#define BENCH_CLIENTS           2
+#define BENCH_QUEUE_LIMIT       8     // WS_MAX_QUEUED_MESSAGES in platformio.ini
+#define BENCH_BYTES_PER_MS      150   // 1.5 Mbaud
+#define BENCH_SLOW_DRAIN_MS     50
+
+// a client's send queue, frames are only counted
+typedef struct
+{
+  unsigned long drainEvery; // ms, 0 to keep up
+  size_t frames;
+  size_t bytes;
+  unsigned long received;
+  unsigned long dropped;
+} BenchClient;
+
+typedef struct
+{
+  BenchClient clients[BENCH_CLIENTS];
+  size_t heldBytes; // queued data, shared frames counted once
+  size_t peakHeld;
+  unsigned long frames;
+} BenchSink;
+
+static void initSink(BenchSink& sink)
+{
+  memset(&sink, 0, sizeof(sink));
+  sink.clients[1].drainEvery = BENCH_SLOW_DRAIN_MS;
+}
+
+static void drain(BenchSink& sink, unsigned long now, bool shared)
+{
+  for(int c = 0; c < BENCH_CLIENTS; c++)
+  {
+    BenchClient& client = sink.clients[c];
+    if(client.drainEvery && now % client.drainEvery)
+      continue;
+    // shared frames are freed with the last client that held them, the
+    // fast client never holds any
+    if(!shared || c == BENCH_CLIENTS - 1)
+      sink.heldBytes -= client.bytes;
+    client.received += client.bytes;
+    client.frames = 0;
+    client.bytes = 0;
+  }
+}
+
+// the AsyncWebSocket queue: full queues drop the frame
+static bool enqueue(BenchSink& sink, BenchClient& client, size_t len)
+{
+  if(client.frames >= BENCH_QUEUE_LIMIT)
+  {
+    client.dropped += len;
+    return false;
+  }
+  client.frames++;
+  client.bytes += len;
+  return true;
+}
+
+static void track(BenchSink& sink)
+{
+  if(sink.heldBytes > sink.peakHeld)
+    sink.peakHeld = sink.heldBytes;
+}
+
+// former path: textAll(String(m) + "\n"), one copy of the frame per client
+static void sendLegacy(BenchSink& sink, const char* line)
+{
+  std::string frame = std::string(line) + "\n";
+  for(int c = 0; c < BENCH_CLIENTS; c++)
+  {
+    std::string copy(frame);
+    if(enqueue(sink, sink.clients[c], copy.size()))
+      sink.heldBytes += copy.size();
+  }
+  sink.frames++;
+  track(sink);
+}
+
+typedef struct
+{
+  BenchSink* sink;
+  WebSerialClients* clients;
+} SharedSink;
+
+// current path: one buffer per frame, slow clients skip it
+static void sendShared(void* arg, const char* data, size_t len)
+{
+  SharedSink* shared = (SharedSink*)arg;
+  BenchSink& sink = *shared->sink;
+  char* buffer = NULL;
+  for(int c = 0; c < BENCH_CLIENTS; c++)
+  {
+    BenchClient& client = sink.clients[c];
+    char notice[WEBSERIAL_NOTICE_SIZE];
+    size_t noticeLen;
+    if(!shared->clients->admit(c, client.frames >= BENCH_QUEUE_LIMIT, len, notice, noticeLen))
+    {
+      client.dropped += len;
+      continue;
+    }
+    if(noticeLen)
+      enqueue(sink, client, noticeLen);
+    if(!buffer)
+    {
+      buffer = new char[len];
+      memcpy(buffer, data, len);
+      sink.heldBytes += len;
+    }
+    enqueue(sink, client, len);
+  }
+  delete[] buffer;
+  sink.frames++;
+  track(sink);
+}
+
+// kernel style boot messages of 40 to 120 characters
+static void makeLine(char* buf, size_t size, unsigned long i)
+{
+  int width = 40 + (i * 37) % 80;
+  int n = snprintf(buf, size, "[%5lu.%06lu] ", i / 1000, (i * 7919) % 1000000);
+  for(; n < width && n < (int)size - 1; n++)
+    buf[n] = 'a' + (n + i) % 26;
+  buf[n] = '\0';
+}
+
+typedef struct
+{
+  double secs;
+  unsigned long allocations;
+  unsigned long bytes;
+  unsigned long simMs;
+} SerialResult;
+
+template <typename SEND, typename TICK>
+static SerialResult replay(unsigned long lines, BenchSink& sink, bool shared, SEND send, TICK tick)
+{
+  SerialResult result = { 0, 0, 0, 0 };
+  unsigned long allocations = heapAllocations();
+  unsigned long now = 0;
+  size_t due = 0; // bytes the UART delivered up to now
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(unsigned long i = 0; i < lines; i++)
+  {
+    char line[128];
+    makeLine(line, sizeof(line), i);
+    size_t len = strlen(line) + 1;
+    while(due < result.bytes + len)
+    {
+      now++;
+      due += BENCH_BYTES_PER_MS;
+      tick(now);
+      drain(sink, now, shared);
+    }
+    send(line);
+    result.bytes += len;
+  }
+  // let the timer flush what is left
+  for(unsigned long end = now + WEBSERIAL_FLUSH_MS; now <= end; now++)
+  {
+    tick(now);
+    drain(sink, now, shared);
+  }
+  result.secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  result.allocations = heapAllocations() - allocations;
+  result.simMs = now;
+  return result;
+}
+
+static void report(const char* name, unsigned long lines, const SerialResult& result, const BenchSink& sink)
+{
+  double simSecs = result.simMs / 1000.0;
+  printf("%-10s %12.0f %10lu %10.0f %11.2f %10lu %10lu %10lu\n", name,
+    result.secs > 0 ? result.bytes / result.secs : 0.0, sink.frames, sink.frames / simSecs,
+    (double)result.allocations / lines, (unsigned long)sink.peakHeld,
+    sink.clients[0].dropped, sink.clients[1].dropped);
+}
+
+void runSerialBench(unsigned long lines)
+{
+  printf("%lu console lines at %d bytes/ms, frame %d bytes, flush after %d ms, queue limit %d, slow client drains every %d ms\n\n",
+    lines, BENCH_BYTES_PER_MS, WEBSERIAL_FRAME_SIZE, WEBSERIAL_FLUSH_MS, BENCH_QUEUE_LIMIT, BENCH_SLOW_DRAIN_MS);
+  printf("%-10s %12s %10s %10s %11s %10s %10s %10s\n",
+    "path", "bytes/s", "frames", "frames/s", "allocs/line", "peak held", "fast drop", "slow drop");
+
+  BenchSink sink;
+  initSink(sink);
+  SerialResult result = replay(lines, sink, false,
+    [&sink](const char* line) { sendLegacy(sink, line); },
+    [](unsigned long now) { });
+  report("per-line", lines, result, sink);
+
+  initSink(sink);
+  WebSerialClients clients;
+  clients.add(1);
+  clients.add(2);
+  SharedSink shared = { &sink, &clients };
+  WebSerialBuffer* out = new WebSerialBuffer(sendShared, &shared);
+  unsigned long now = 0;
+  result = replay(lines, sink, true,
+    [out, &now](const char* line) { out->write(line, strlen(line), now); out->write("\n", 1, now); },
+    [out, &now](unsigned long t) { now = t; out->iterate(now); });
+  report("coalesced", lines, result, sink);
+  delete out;
+}
+
+// Console bridge: bytes arrive at line rate in the 128 byte UART FIFO. The
+// driver interrupt moves them into the receive ring at 120 bytes, or loses
+// them if the ring is full for longer than the FIFO lasts. The reader runs
+// event driven on the ring of SerialBridge, or polls the 256 byte buffer of
+// HardwareSerial every 10 ms as the loop did. Both are held off by other
+// tasks for stallMs every 100 ms.
+
+#define UART_FIFO_SIZE          128
+#define UART_FIFO_THRESHOLD     120
+#define POLL_BUFFER_SIZE        256
+#define POLL_PERIOD_MS          10
+#define STALL_PERIOD_MS         100
+
+typedef struct
+{
+  std::string out;
+  unsigned long frames;
+  unsigned long broken; // frames that are not valid UTF-8
+} BridgeSink;
+
+static bool validUtf8(const char* data, size_t len)
+{
+  for(size_t i = 0; i < len;)
+  {
+    uint8_t c = data[i];
+    size_t n = c < 0x80 ? 1 : c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 0;
+    if(!n || i + n > len)
+      return false;
+    for(size_t j = 1; j < n; j++)
+      if((data[i + j] & 0xC0) != 0x80)
+        return false;
+    i += n;
+  }
+  return true;
+}
+
+static void collectFrame(void* arg, const char* data, size_t len)
+{
+  BridgeSink* sink = (BridgeSink*)arg;
+  sink->out.append(data, len);
+  sink->frames++;
+  if(!validUtf8(data, len))
+    sink->broken++;
+}
+
+typedef struct
+{
+  unsigned long lost;
+  unsigned long fifoOverruns;
+  unsigned long ringOverruns;
+  size_t peakRing;
+} BridgeResult;
+
+static void readRing(std::string& ring, WebSerialBuffer& out, unsigned long ms)
+{
+  for(size_t pos = 0; pos < ring.size(); pos += SERIAL_BRIDGE_CHUNK)
+    out.write(ring.data() + pos, ring.size() - pos < SERIAL_BRIDGE_CHUNK ? ring.size() - pos : SERIAL_BRIDGE_CHUNK, ms);
+  ring.clear();
+}
+
+static BridgeResult replayUart(const std::string& in, unsigned long baud, size_t ringSize,
+  unsigned long pollMs, unsigned long stallMs, BridgeSink& sink)
+{
+  BridgeResult result = { 0, 0, 0, 0 };
+  WebSerialBuffer out(collectFrame, &sink);
+  std::string fifo, ring;
+  bool fifoFull = false, ringFull = false, pending = false;
+  unsigned long lastRun = 0;
+  for(size_t i = 0; i <= in.size(); i++)
+  {
+    unsigned long us = (unsigned long long)i * 10000000 / baud;
+    unsigned long ms = us / 1000;
+    if(i < in.size())
+    {
+      if(fifo.size() < UART_FIFO_SIZE)
+      {
+        fifo += in[i];
+        fifoFull = false;
+      }
+      else
+      {
+        result.lost++;
+        if(!fifoFull)
+          result.fifoOverruns++;
+        fifoFull = true;
+      }
+    }
+    // the interrupt; at the end the receive timeout takes the rest
+    if(fifo.size() >= UART_FIFO_THRESHOLD || (i == in.size() && fifo.size()))
+    {
+      size_t n = ringSize - ring.size() < fifo.size() ? ringSize - ring.size() : fifo.size();
+      if(n < fifo.size() && !ringFull)
+        result.ringOverruns++;
+      ringFull = n < fifo.size();
+      ring.append(fifo, 0, n);
+      fifo.erase(0, n);
+      pending = true;
+      if(ring.size() > result.peakRing)
+        result.peakRing = ring.size();
+    }
+
+    bool stalled = ms % STALL_PERIOD_MS < stallMs;
+    bool due = pollMs ? ms - lastRun >= pollMs : pending;
+    if(!stalled && due)
+    {
+      readRing(ring, out, ms);
+      ringFull = false;
+      pending = false;
+      lastRun = ms;
+    }
+    if(!stalled)
+      out.iterate(ms);
+  }
+  // the reader catches up once the line is quiet
+  ring += fifo;
+  readRing(ring, out, (unsigned long long)in.size() * 10000 / baud);
+  out.flush();
+  return result;
+}
+
+// console text with box drawing, degree signs and emoji in it
+static std::string consoleText(size_t size)
+{
+  static const char* words[] = { "[    2.345678] ", "usb 1-1: new device ", "│ ", "CPU 45.2°C ", "✓ done ", "😀 ", "\r\n" };
+  std::string text;
+  for(unsigned long i = 0; text.size() < size; i++)
+    text += words[(i * 7 + i / 3) % 7];
+  text.resize(size);
+  // no character cut off at the end of the input
+  text.resize(WebSerialBuffer::completeUtf8(text.data(), text.size()));
+  return text;
+}
+
+void runBridgeBench(unsigned long seconds, unsigned long stallMs)
+{
+  static const unsigned long bauds[] = { 115200, 460800, 921600 };
+  printf("%lu s of console output per baud rate, reader held off %lu ms every %d ms\n\n", seconds, stallMs, STALL_PERIOD_MS);
+  printf("%-6s %7s %10s %10s %10s %9s %9s %9s %8s %7s\n",
+    "reader", "baud", "bytes", "forwarded", "lost", "fifo ovf", "ring ovf", "peak ring", "frames", "broken");
+  for(int b = 0; b < 3; b++)
+  {
+    std::string in = consoleText(seconds * bauds[b] / 10);
+    for(int event = 0; event < 2; event++)
+    {
+      BridgeSink sink;
+      sink.frames = 0;
+      sink.broken = 0;
+      BridgeResult result = replayUart(in, bauds[b], event ? SERIAL_BRIDGE_RX_BUFFER : POLL_BUFFER_SIZE,
+        event ? 0 : POLL_PERIOD_MS, stallMs, sink);
+      printf("%-6s %7lu %10lu %10lu %10lu %9lu %9lu %9lu %8lu %7lu%s\n",
+        event ? "event" : "poll", bauds[b], (unsigned long)in.size(), (unsigned long)sink.out.size(),
+        result.lost, result.fifoOverruns, result.ringOverruns, (unsigned long)result.peakRing,
+        sink.frames, sink.broken,
+        result.lost || sink.out == in ? "" : "  MISMATCH");
+    }
+  }
+}
@@ -0,0 +1,65 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+// In-memory replacement for the LittleFS backed ConfigManager. The simulator
+// edits the BoardConfig directly before (re-)initializing the checker.
+
+#include <ConfigManager.h>
+
+void ConfigManager::init()
+{
+  m_configDirty = false;
+  m_loadMicros = 0;
+}
+
+void ConfigManager::setState(uint8_t target, bool enabled)
+{
+  if(target < m_BoardConfig.targetCount)
+    m_BoardConfig.targets[target].enabled = enabled;
+}
+
+Config* ConfigManager::getConfigFunction(CONFIG_TYPE type)
+{
+  return ConfigManager::instance()->getConfig(type);
+}
+
+Config* ConfigManager::getConfig(CONFIG_TYPE type)
+{
+  Config * ptr = NULL;
+  switch(type)
+  {
+    case BOARD:
+      ptr = &m_BoardConfig;
+      break;
+    default:
+      ptr = NULL;
+  }
+  return ptr;
+}
@@ -0,0 +1,315 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <Arduino.h>
+
+#include <SimHal.h>
+#include <Constants.h>
+
+const char* scenarioName(SCENARIO scenario)
+{
+  switch(scenario)
+  {
+    case HEALTHY:     return "healthy";
+    case JITTERY:     return "jittery";
+    case STUCK_HIGH:  return "stuck-high";
+    case STUCK_LOW:   return "stuck-low";
+    case POWER_OFF:   return "power-off";
+    default:          return "unknown";
+  }
+}
+
+SimBoard::SimBoard(const TargetConfig& pins, SCENARIO scenario, uint32_t seed, unsigned long faultTime, unsigned long bootTime)
+  : m_hal(0), m_pins(pins), m_scenario(scenario), m_rng(seed ? seed : 1), m_bootTime(bootTime), m_faulted(false),
+    m_level(0), m_power(1), m_resetLevel(LOW), m_powerLevel(LOW),
+    m_firstDetection(SIM_NEVER), m_actions(0), m_falseActions(0), m_edges(0)
+{
+  // healthy and jittery boards never fail on purpose
+  m_faultTime = (scenario == HEALTHY || scenario == JITTERY) ? SIM_NEVER : faultTime;
+  m_nextEdge = nextInterval();
+}
+
+uint32_t SimBoard::random()
+{
+  // xorshift32, good enough for trace generation
+  m_rng ^= m_rng << 13;
+  m_rng ^= m_rng >> 17;
+  m_rng ^= m_rng << 5;
+  return m_rng;
+}
+
+unsigned long SimBoard::nextInterval()
+{
+  uint32_t r = random();
+  if(m_scenario != JITTERY)
+  {
+    // +/-5% around the nominal period
+    return SIM_DEFAULT_PERIOD - SIM_DEFAULT_PERIOD / 20 + r % (SIM_DEFAULT_PERIOD / 10);
+  }
+  // mostly close to the period, sometimes starved for a few seconds
+  uint32_t bucket = r % 100;
+  r = random();
+  if(bucket < 90)
+    return 500 + r % 1000;
+  if(bucket < 99)
+    return 1500 + r % 2500;
+  return 4000 + r % 4000;
+}
+
+void SimBoard::setPin(uint8_t pin, int& level, int val, unsigned long now)
+{
+  if(level == val)
+    return;
+  level = val;
+  if(m_hal)
+    m_hal->raise(pin, now);
+}
+
+unsigned long SimBoard::nextEvent() const
+{
+  return !m_faulted && m_faultTime < m_nextEdge ? m_faultTime : m_nextEdge;
+}
+
+void SimBoard::applyFault(unsigned long now)
+{
+  m_faulted = true;
+  m_nextEdge = SIM_NEVER;
+  switch(m_scenario)
+  {
+    case STUCK_HIGH:
+      setPin(m_pins.heartBeatPin, m_level, 1, now);
+      break;
+    case STUCK_LOW:
+      setPin(m_pins.heartBeatPin, m_level, 0, now);
+      break;
+    case POWER_OFF:
+      setPin(m_pins.heartBeatPin, m_level, 0, now);
+      setPin(m_pins.powerWatchPin, m_power, 0, now);
+      break;
+    default:
+      break;
+  }
+}
+
+void SimBoard::advance(unsigned long now)
+{
+  while(true)
+  {
+    bool fault = !m_faulted && m_faultTime <= m_nextEdge;
+    unsigned long next = fault ? m_faultTime : m_nextEdge;
+    if(next > now)
+      break;
+    if(fault)
+    {
+      applyFault(next);
+    }
+    else
+    {
+      m_edges++;
+      m_nextEdge += nextInterval();
+      setPin(m_pins.heartBeatPin, m_level, !m_level, next);
+    }
+  }
+}
+
+int SimBoard::heartBeat(unsigned long now)
+{
+  advance(now);
+  return m_level;
+}
+
+int SimBoard::power(unsigned long now)
+{
+  advance(now);
+  return m_power;
+}
+
+void SimBoard::drive(uint8_t pin, uint8_t val, unsigned long now)
+{
+  advance(now);
+  int* level = pin == m_pins.resetPin ? &m_resetLevel : (pin == m_pins.powerPin ? &m_powerLevel : 0);
+  if(!level || *level == val)
+    return;
+  *level = val;
+
+  // the power pulse opens every recovery sequence
+  if(pin == m_pins.powerPin && val == HIGH)
+  {
+    m_actions++;
+    if(now < m_faultTime)
+      m_falseActions++;
+    else if(m_firstDetection == SIM_NEVER)
+      m_firstDetection = now;
+  }
+  // releasing either line reboots the board, which clears a fault that
+  // already happened
+  if(val == LOW)
+  {
+    setPin(m_pins.powerWatchPin, m_power, 1, now);
+    setPin(m_pins.heartBeatPin, m_level, 0, now);
+    m_nextEdge = now + m_bootTime;
+  }
+}
+
+SimHal::SimHal()
+  : m_boardCount(0), m_now(0)
+{
+  for(int i = 0; i < SIM_MAX_PINS; i++)
+  {
+    m_pinBoard[i] = 0;
+    m_isrs[i] = 0;
+    m_isrArgs[i] = 0;
+  }
+  for(int i = 0; i < HAL_MAXTIMERS; i++)
+  {
+    m_timerDeadlines[i] = SIM_NEVER;
+    m_timerCallbacks[i] = 0;
+  }
+}
+
+// detaches all boards and interrupts and restarts the clock at now
+void SimHal::reset(unsigned long now)
+{
+  m_boardCount = 0;
+  m_now = now;
+  for(int i = 0; i < SIM_MAX_PINS; i++)
+  {
+    m_pinBoard[i] = 0;
+    m_isrs[i] = 0;
+  }
+  for(int i = 0; i < HAL_MAXTIMERS; i++)
+    m_timerDeadlines[i] = SIM_NEVER;
+}
+
+void SimHal::attach(SimBoard* board)
+{
+  if(m_boardCount == MAX_TARGETS)
+    return;
+  m_boards[m_boardCount++] = board;
+  const TargetConfig& pins = board->pins();
+  uint8_t used[4] = { pins.heartBeatPin, pins.powerWatchPin, pins.resetPin, pins.powerPin };
+  for(int i = 0; i < 4; i++)
+    if(used[i] < SIM_MAX_PINS)
+      m_pinBoard[used[i]] = board;
+  board->connect(this);
+}
+
+unsigned long SimHal::nextTimer() const
+{
+  unsigned long next = SIM_NEVER;
+  for(int i = 0; i < HAL_MAXTIMERS; i++)
+    if(m_timerDeadlines[i] < next)
+      next = m_timerDeadlines[i];
+  return next;
+}
+
+unsigned long SimHal::nextEvent() const
+{
+  unsigned long next = nextTimer();
+  for(int i = 0; i < m_boardCount; i++)
+    if(m_boards[i]->nextEvent() < next)
+      next = m_boards[i]->nextEvent();
+  return next;
+}
+
+void SimHal::advanceBoards(unsigned long now)
+{
+  for(int i = 0; i < m_boardCount; i++)
+    m_boards[i]->advance(now);
+}
+
+void SimHal::advanceTo(unsigned long now)
+{
+  // timers fire in order with the clock set to their deadline, the boards
+  // raise their edges with the clock set to the edge time
+  unsigned long next;
+  while((next = nextTimer()) <= now)
+  {
+    advanceBoards(next);
+    if(next > m_now)
+      m_now = next;
+    for(int i = 0; i < HAL_MAXTIMERS; i++)
+    {
+      if(m_timerDeadlines[i] == next)
+      {
+        m_timerDeadlines[i] = SIM_NEVER;
+        if(m_timerCallbacks[i])
+          m_timerCallbacks[i]();
+      }
+    }
+  }
+  advanceBoards(now);
+  if(now > m_now)
+    m_now = now;
+}
+
+void SimHal::armTimer(HAL_TIMER timer, uint64_t us, void (*callback)())
+{
+  // the virtual clock ticks in ms, round up so a timer never fires early
+  m_timerDeadlines[timer] = m_now + (unsigned long)((us + 999) / 1000);
+  m_timerCallbacks[timer] = callback;
+}
+
+void SimHal::raise(uint8_t pin, unsigned long now)
+{
+  unsigned long saved = m_now;
+  if(now > m_now)
+    m_now = now;
+  if(pin < SIM_MAX_PINS && m_isrs[pin])
+    m_isrs[pin](m_isrArgs[pin]);
+  m_now = saved;
+}
+
+void SimHal::attachInterrupt(uint8_t pin, void (*isr)(void*), void* arg, int mode)
+{
+  if(pin >= SIM_MAX_PINS)
+    return;
+  m_isrs[pin] = isr;
+  m_isrArgs[pin] = arg;
+}
+
+int SimHal::digitalRead(uint8_t pin)
+{
+  SimBoard* board = pin < SIM_MAX_PINS ? m_pinBoard[pin] : 0;
+  if(!board)
+    return LOW;
+  if(pin == board->pins().heartBeatPin)
+    return board->heartBeat(m_now);
+  if(pin == board->pins().powerWatchPin)
+    return board->power(m_now);
+  return LOW;
+}
+
+void SimHal::digitalWrite(uint8_t pin, uint8_t val)
+{
+  SimBoard* board = pin < SIM_MAX_PINS ? m_pinBoard[pin] : 0;
+  if(board)
+    board->drive(pin, val, m_now);
+}
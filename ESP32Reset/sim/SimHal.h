@@ -0,0 +1,146 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#ifndef _SIMHAL_H_INCLUDED_
+#define _SIMHAL_H_INCLUDED_
+
+#include <Arduino.h>
+
+#include <Hal.h>
+#include <Constants.h>
+
+#define SIM_NEVER                   ((unsigned long)-1)
+#define SIM_DEFAULT_PERIOD          1000  // heartbeat.py toggles once a second
+#define SIM_DEFAULT_BOOT_TIME       30000 // time until heartbeat resumes after reset
+#define SIM_MAX_PINS                64
+
+typedef enum : uint8_t
+{
+  HEALTHY = 0,
+  JITTERY,
+  STUCK_HIGH,
+  STUCK_LOW,
+  POWER_OFF,
+  MAXSCENARIOS
+} SCENARIO;
+
+const char* scenarioName(SCENARIO scenario);
+
+class SimHal;
+
+// behavioural model of a supervised board; heartbeat edges are generated
+// lazily whenever time advances, a fault is injected at faultTime and any
+// reset or power pulse reboots the board. Every level change of its
+// heartbeat or power watch pin is raised as a pin interrupt on the
+// connected SimHal.
+class SimBoard
+{
+public:
+  SimBoard(const TargetConfig& pins, SCENARIO scenario, uint32_t seed, unsigned long faultTime, unsigned long bootTime = SIM_DEFAULT_BOOT_TIME);
+
+  void connect(SimHal* hal) { m_hal = hal; }
+  const TargetConfig& pins() const { return m_pins; }
+  void advance(unsigned long now);
+  unsigned long nextEvent() const;
+
+  int heartBeat(unsigned long now);
+  int power(unsigned long now);
+  void drive(uint8_t pin, uint8_t val, unsigned long now);
+
+  unsigned long faultTime() const { return m_faultTime; }
+  unsigned long firstDetection() const { return m_firstDetection; }
+  int actions() const { return m_actions; }
+  int falseActions() const { return m_falseActions; }
+  unsigned long edges() const { return m_edges; }
+private:
+  void applyFault(unsigned long now);
+  void setPin(uint8_t pin, int& level, int val, unsigned long now);
+  unsigned long nextInterval();
+  uint32_t random();
+
+  SimHal*                   m_hal;
+  TargetConfig              m_pins;
+  SCENARIO                  m_scenario;
+  uint32_t                  m_rng;
+  unsigned long             m_faultTime;
+  unsigned long             m_bootTime;
+  bool                      m_faulted;
+
+  int                       m_level;
+  int                       m_power;
+  unsigned long             m_nextEdge;
+  int                       m_resetLevel;
+  int                       m_powerLevel;
+
+  unsigned long             m_firstDetection;
+  int                       m_actions;
+  int                       m_falseActions;
+  unsigned long             m_edges;
+};
+
+// virtual clock; delay() jumps time forward instead of sleeping, pin
+// interrupts and the one-shot timers fire at their exact virtual time.
+// Several boards can be attached, each on its own pins
+class SimHal : public Hal
+{
+public:
+  SimHal();
+
+  void reset(unsigned long now);
+  void attach(SimBoard* board);
+  void advanceTo(unsigned long now);
+  unsigned long nextTimer() const;
+  unsigned long nextEvent() const; // earliest board event or timer
+  void raise(uint8_t pin, unsigned long now);
+
+  void pinMode(uint8_t pin, uint8_t mode) { }
+  int digitalRead(uint8_t pin);
+  void digitalWrite(uint8_t pin, uint8_t val);
+  unsigned long millis() { return m_now; }
+  void delay(unsigned long ms) { advanceTo(m_now + ms); }
+  void yield() { }
+
+  unsigned long micros() { return m_now * 1000; }
+  void attachInterrupt(uint8_t pin, void (*isr)(void*), void* arg, int mode);
+  void armTimer(HAL_TIMER timer, uint64_t us, void (*callback)());
+private:
+  void advanceBoards(unsigned long now);
+
+  SimBoard*                 m_boards[MAX_TARGETS];
+  int                       m_boardCount;
+  SimBoard*                 m_pinBoard[SIM_MAX_PINS];
+  unsigned long             m_now;
+  void                      (*m_isrs[SIM_MAX_PINS])(void*);
+  void*                     m_isrArgs[SIM_MAX_PINS];
+  unsigned long             m_timerDeadlines[HAL_MAXTIMERS];
+  void                      (*m_timerCallbacks[HAL_MAXTIMERS])();
+};
+
+#endif // _SIMHAL_H_INCLUDED_
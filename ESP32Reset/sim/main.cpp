@@ -0,0 +1,213 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+// Host-native simulator for the SanityChecker. Replays randomized heartbeat
+// traces against the unmodified watchdog logic on a virtual clock and reports
+// decisions, time-to-detect and false resets per scenario.
+
+#include <Arduino.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <chrono>
+
+#include <Constants.h>
+#include <ConfigManager.h>
+#include <SanityChecker.h>
+#include <PulseEngine.h>
+#include <MemLogger.h>
+#include <SimHal.h>
+#include <LogBench.h>
+#include <SerialBench.h>
+#include <ProbeBench.h>
+
+typedef struct
+{
+  unsigned long runs = 0;
+  unsigned long faults = 0;
+  unsigned long detected = 0;
+  unsigned long actions = 0;
+  unsigned long falseActions = 0;
+  unsigned long edges = 0;
+  double sumDetect = 0;
+  unsigned long maxDetect = 0;
+  IntervalStats intervals;
+} ScenarioStats;
+
+static void runTrace(SimHal& hal, SCENARIO scenario, uint32_t seed, unsigned long duration, ScenarioStats& stats)
+{
+  BoardConfig* boardcfg = reinterpret_cast<BoardConfig*>(ConfigManager::instance()->getConfig(CONFIG_TYPE::BOARD));
+
+  // every target runs the same scenario with its own seed and fault time
+  SimBoard* boards[MAX_TARGETS];
+  hal.reset(0);
+  for(int t = 0; t < boardcfg->targetCount; t++)
+  {
+    const TargetConfig& target = boardcfg->targets[t];
+    uint32_t boardSeed = seed * MAX_TARGETS + t;
+
+    // inject the fault somewhere after the boot cooldown is over
+    unsigned long earliest = target.cooldownTime + target.lockupTime;
+    unsigned long window = duration > 2 * earliest ? duration / 2 - earliest / 2 : 1;
+    unsigned long faultTime = earliest + (boardSeed * 2654435761u) % window;
+
+    boards[t] = new SimBoard(target, scenario, boardSeed, faultTime);
+    hal.attach(boards[t]);
+  }
+
+  SanityChecker* checker = SanityChecker::instance();
+  checker->init(0);
+  while(hal.millis() < duration)
+  {
+    // jump straight to the next heartbeat edge or timer expiry; iterate()
+    // does nothing unless one of them happened
+    unsigned long next = hal.nextEvent();
+    hal.advanceTo(next < duration ? next : duration);
+    PulseEngine::instance()->iterate();
+    checker->iterate(hal.millis());
+    // the service task drains the watchdog's log queue on the device
+    MemLogger::instance()->iterate();
+  }
+  // let a waveform still being played finish before the next trace
+  while(PulseEngine::instance()->busy())
+    hal.advanceTo(hal.nextTimer());
+  PulseEngine::instance()->iterate();
+
+  stats.runs++;
+  for(int t = 0; t < boardcfg->targetCount; t++)
+  {
+    SimBoard* board = boards[t];
+    IntervalStats intervals;
+    checker->heartBeatStats(t, intervals);
+    stats.intervals.merge(intervals);
+    stats.actions += board->actions();
+    stats.falseActions += board->falseActions();
+    stats.edges += board->edges();
+    if(board->faultTime() != SIM_NEVER && board->faultTime() < duration)
+    {
+      stats.faults++;
+      if(board->firstDetection() != SIM_NEVER)
+      {
+        unsigned long detect = board->firstDetection() - board->faultTime();
+        stats.detected++;
+        stats.sumDetect += detect;
+        if(detect > stats.maxDetect)
+          stats.maxDetect = detect;
+      }
+    }
+    delete board;
+  }
+}
+
+static void usage(const char* name)
+{
+  printf("usage: %s [-n traces per scenario] [-d duration s] [-s seed] [-t targets]\n"
+         "          [-l lockup ms] [-c cooldown ms] [-b heartbeat count]\n"
+         "       %s -m messages   (log microbenchmark)\n"
+         "       %s -w lines      (WebSerial output benchmark)\n"
+         "       %s -u seconds [-x stall ms]   (console bridge benchmark)\n"
+         "       %s -p seconds    (liveness probe benchmark, seconds per phase)\n", name, name, name, name, name);
+}
+
+int main(int argc, char** argv)
+{
+  unsigned long traces = 1000;
+  unsigned long duration = 900000;
+  uint32_t seed = 1;
+  unsigned long bridgeSeconds = 0;
+  unsigned long stallMs = 20;
+
+  BoardConfig* boardcfg = reinterpret_cast<BoardConfig*>(ConfigManager::instance()->getConfig(CONFIG_TYPE::BOARD));
+
+  SimHal hal;
+  Hal::install(&hal);
+
+  // give every target its own set of pins
+  for(int t = 0; t < MAX_TARGETS; t++)
+  {
+    boardcfg->targets[t].heartBeatPin = t;
+    boardcfg->targets[t].powerWatchPin = MAX_TARGETS + t;
+    boardcfg->targets[t].resetPin = 2 * MAX_TARGETS + t;
+    boardcfg->targets[t].powerPin = 3 * MAX_TARGETS + t;
+  }
+
+  int opt, value;
+  while((opt = getopt(argc, argv, "n:d:s:t:l:c:b:m:w:u:x:p:h")) != -1)
+  {
+    switch(opt)
+    {
+      case 'n': traces = strtoul(optarg, NULL, 10); break;
+      case 'd': duration = strtoul(optarg, NULL, 10) * 1000; break;
+      case 's': seed = strtoul(optarg, NULL, 10); break;
+      case 't':
+        value = atoi(optarg);
+        boardcfg->targetCount = value < 1 ? 1 : (value > MAX_TARGETS ? MAX_TARGETS : value);
+        break;
+      case 'l': value = atoi(optarg); for(int t = 0; t < MAX_TARGETS; t++) boardcfg->targets[t].lockupTime = value; break;
+      case 'c': value = atoi(optarg); for(int t = 0; t < MAX_TARGETS; t++) boardcfg->targets[t].cooldownTime = value; break;
+      case 'b': value = atoi(optarg); for(int t = 0; t < MAX_TARGETS; t++) boardcfg->targets[t].heartBeatCnt = value; break;
+      case 'm': runLogBench(strtoul(optarg, NULL, 10)); return 0;
+      case 'w': runSerialBench(strtoul(optarg, NULL, 10)); return 0;
+      case 'u': bridgeSeconds = strtoul(optarg, NULL, 10); break;
+      case 'x': stallMs = strtoul(optarg, NULL, 10); break;
+      case 'p': runProbeBench(strtoul(optarg, NULL, 10)); return 0;
+      default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+    }
+  }
+
+  if(bridgeSeconds)
+  {
+    runBridgeBench(bridgeSeconds, stallMs);
+    return 0;
+  }
+
+  const TargetConfig& target = boardcfg->targets[0];
+  printf("%d targets, lockup %d ms, cooldown %d ms, heartbeat count %d, %lu traces of %lu s per scenario\n\n",
+    boardcfg->targetCount, target.lockupTime, target.cooldownTime, target.heartBeatCnt, traces, duration / 1000);
+  printf("%-11s %8s %8s %8s %9s %10s %10s %9s %9s %9s %9s %12s\n",
+    "scenario", "faults", "detect", "actions", "false", "ttd avg", "ttd max", "hb p50", "hb p99", "hb p99.9", "hb max", "traces/s");
+
+  for(int s = 0; s < MAXSCENARIOS; s++)
+  {
+    ScenarioStats stats;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(unsigned long i = 0; i < traces; i++)
+      runTrace(hal, (SCENARIO)s, seed + i * MAXSCENARIOS + s, duration, stats);
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%-11s %8lu %8lu %8lu %9lu %8.0fms %8lums %7ums %7ums %7ums %7ums %12.0f\n",
+      scenarioName((SCENARIO)s), stats.faults, stats.detected, stats.actions, stats.falseActions,
+      stats.detected ? stats.sumDetect / stats.detected : 0.0, stats.maxDetect,
+      stats.intervals.percentile(0.5) / 1000, stats.intervals.percentile(0.99) / 1000,
+      stats.intervals.percentile(0.999) / 1000, stats.intervals.max() / 1000,
+      secs > 0 ? stats.runs / secs : 0.0);
+  }
+  return 0;
+}
@@ -30,34 +30,151 @@
 
 #include <ConfigManager.h>
 #include <MemLogger.h>
+#include <Metrics.h>
+
+#include <ConfigRecord.h>
+
+#include <Storage.h>
 
 #include <ArduinoJson.h>
-#include <LITTLEFS.h>
+#include <IPAddress.h>
+#include <Preferences.h>
+
+// the web server task edits the config while the service task writes it
+static SemaphoreHandle_t s_configLock = NULL;
+#define CONFIG_LOCK()     xSemaphoreTake(s_configLock, portMAX_DELAY)
+#define CONFIG_UNLOCK()   xSemaphoreGive(s_configLock)
+
+static void slotKey(char* key, size_t size, int slot)
+{
+  snprintf(key, size, "%s%d", CONFIG_NVS_KEY, slot);
+}
+
+// copies the keys present in src into the target, missing keys keep their value
+static void readTarget(JsonObject src, TargetConfig& target)
+{
+  if(src.isNull())
+    return;
+  if(src.containsKey("heartBeatPin"))   target.heartBeatPin   = src["heartBeatPin"];
+  if(src.containsKey("powerWatchPin"))  target.powerWatchPin  = src["powerWatchPin"];
+  if(src.containsKey("resetPin"))       target.resetPin       = src["resetPin"];
+  if(src.containsKey("powerPin"))       target.powerPin       = src["powerPin"];
+  if(src.containsKey("lockupTime"))     target.lockupTime     = src["lockupTime"];
+  if(src.containsKey("cooldownTime"))   target.cooldownTime   = src["cooldownTime"];
+  if(src.containsKey("heartBeatCnt"))   target.heartBeatCnt   = src["heartBeatCnt"];
+  if(src.containsKey("enabled"))        target.enabled        = src["enabled"];
+  if(src.containsKey("probes"))         target.probes         = src["probes"];
+  if(src.containsKey("quorum"))         target.quorum         = src["quorum"];
+  if(src.containsKey("udpPort"))        target.udpPort        = src["udpPort"];
+  if(src.containsKey("httpPort"))       target.httpPort       = src["httpPort"];
+  if(src.containsKey("httpPath"))       target.httpPath       = src["httpPath"].as<String>();
+  if(src.containsKey("probeInterval"))  target.probeInterval  = src["probeInterval"];
+  if(src.containsKey("udpTimeout"))     target.udpTimeout     = src["udpTimeout"];
+  if(src.containsKey("icmpTimeout"))    target.icmpTimeout    = src["icmpTimeout"];
+  if(src.containsKey("httpTimeout"))    target.httpTimeout    = src["httpTimeout"];
+  // dotted IPv4, empty for none
+  IPAddress address;
+  if(src.containsKey("probeAddress"))
+    target.probeAddress = address.fromString(src["probeAddress"] | "") ? (uint32_t)address : 0;
+}
+
+static void readTargets(JsonDocument& config, BoardConfig& board)
+{
+  // configs from before multi-target support keep the watchdog settings in
+  // BoardConfig, they belong to the first target
+  readTarget(config["BoardConfig"], board.targets[0]);
+
+  JsonArray targets = config["Targets"];
+  if(targets.isNull() || targets.size() == 0)
+    return;
+  size_t count = targets.size() < MAX_TARGETS ? targets.size() : MAX_TARGETS;
+  for(size_t i = 0; i < count; i++)
+    readTarget(targets[i], board.targets[i]);
+  board.targetCount = count;
+}
 
 void ConfigManager::init()
 {
   // init all functions
+  s_configLock = xSemaphoreCreateMutex();
   m_configDirty = false;
+  m_dirtySince = 0;
+  m_lastChange = 0;
+  m_slot = -1;
+  m_generation = 0;
+  unsigned long start = micros();
+  if(loadRecord())
+  {
+    m_loadMicros = micros() - start;
+    MemLogger::instance()->logEvent(LOGMSG_CM_LOADED, m_loadMicros);
+    printConfig();
+  }
+  else if(loadJsonFile())
+  {
+    // one-time migration, from now on the record is read
+    saveConfig();
+    m_loadMicros = micros() - start;
+    MemLogger::instance()->logEvent(LOGMSG_CM_MIGRATED, m_loadMicros);
+    printConfig();
+  }
+  else
+  {
+    m_loadMicros = micros() - start;
+    MemLogger::instance()->logMessage("=CM: Using configuration from firmware defaults\n");
+  }
+}
+
+// newest valid record of the slots; a write cut short by a power loss
+// fails its crc and the slot written before it is used instead
+bool ConfigManager::loadRecord()
+{
+  ConfigRecord rec;
+  BoardConfig candidate;
+  bool found = false;
+  Preferences prefs;
+  if(!prefs.begin(CONFIG_NVS_NAMESPACE, true))
+    return false;
+  for(int slot = -1; slot < CONFIG_NVS_SLOTS; slot++)
+  {
+    char key[16];
+    if(slot < 0)
+      strcpy(key, CONFIG_NVS_KEY);
+    else
+      slotKey(key, sizeof(key), slot);
+    // records of older firmware are shorter
+    size_t len = prefs.getBytesLength(key);
+    if(len == 0)
+      continue;
+    if(len > sizeof(rec) || prefs.getBytes(key, &rec, len) != len || rec.size != len || !unpackConfig(rec, candidate))
+    {
+      MemLogger::instance()->logMessage("=CM: Config record in NVS is corrupt!\n");
+      continue;
+    }
+    if(!found || candidate.configVersion - m_BoardConfig.configVersion > 0)
+    {
+      m_BoardConfig = candidate;
+      m_slot = slot;
+    }
+    found = true;
+  }
+  prefs.end();
+  return found;
+}
+
+// the config.json of earlier firmware, only read while NVS holds no record
+bool ConfigManager::loadJsonFile()
+{
   DynamicJsonDocument config(CONFIGFILE_DEFAULT_SIZE);
   bool configFileSane = false;
-  if (LITTLEFS.begin())
+  if (Storage::instance()->mount())
   {
-    MemLogger::instance()->logMessage("=CM: Mounted file system\n");
     // parse json config file
-    File configFile = LITTLEFS.open(CONFIGFILE_DEFAULT_NAME, "r");
-    if (configFile)
+    size_t size;
+    std::unique_ptr<char[]> buf;
+    if (Storage::instance()->readFile(CONFIGFILE_DEFAULT_NAME, buf, size))
     {
-        // Allocate a buffer to store contents of the file.
         MemLogger::instance()->logMessage("=CM: JSON Config File found!\n");
 
-        // parse
-        size_t size = configFile.size();
-
-        // Allocate a buffer to store contents of the file.
-        std::unique_ptr<char[]> buf(new char[size]);
-
-        configFile.readBytes(buf.get(), size);
-
         auto error = deserializeJson(config, buf.get());
         if (error)
         {
@@ -80,14 +197,9 @@ void ConfigManager::init()
             m_BoardConfig.hotSpotPwd        = config["BoardConfig"].containsKey("hotSpotPwd")         ? config["BoardConfig"]["hotSpotPwd"].as<String>() : DEFAULT_HOTSPOTPWD ;
             m_BoardConfig.wifiName          = config["BoardConfig"].containsKey("wifiName")           ? config["BoardConfig"]["wifiName"].as<String>() : DEFAULT_WIFISSID ;
             m_BoardConfig.wifiPwd           = config["BoardConfig"].containsKey("wifiPwd")            ? config["BoardConfig"]["wifiPwd"].as<String>() : DEFAULT_WIFIPWD ;
+            m_BoardConfig.consoleBaud       = config["BoardConfig"].containsKey("consoleBaud")        ? config["BoardConfig"]["consoleBaud"] : DEFAULT_CONSOLE_BAUD ;
 
-            m_BoardConfig.lockupTime        = config["BoardConfig"].containsKey("lockupTime")         ? config["BoardConfig"]["lockupTime"] : DEFAULT_LOCKUP_TIME;
-            m_BoardConfig.cooldownTime      = config["BoardConfig"].containsKey("cooldownTime")       ? config["BoardConfig"]["cooldownTime"] : DEFAULT_COOLDOWN_TIME;
-            m_BoardConfig.heartBeatCnt      = config["BoardConfig"].containsKey("heartBeatCnt")       ? config["BoardConfig"]["heartBeatCnt"] : DEFAULT_HEARTBEAT_COUNT;
-
-            m_BoardConfig.enabled           = config["BoardConfig"].containsKey("enabled")            ? config["BoardConfig"]["enabled"] : DEFAULT_WD_ENABLED;
-
-            printConfig();
+            readTargets(config, m_BoardConfig);
 
             MemLogger::instance()->logMessage("=CM: JSON Config file successfully loaded!\n");
             configFileSane = true;
@@ -97,24 +209,42 @@ void ConfigManager::init()
           //  Serial.println("=CM: Error parsing JSON file!");
           //}
         }
-        configFile.close();
     }
     else
       MemLogger::instance()->logMessage("=CM: JSON Config file load failed!\n");
-
-    LITTLEFS.end();
   }
-  else
-  {
-    MemLogger::instance()->logMessage("=CM: File System issue!\n");
-  }
-  if(!configFileSane)
-    MemLogger::instance()->logMessage("=CM: Using configuration from firmware defaults\n");
+  return configFileSane;
 }
 
-void ConfigManager::setState(bool enabled)
+void ConfigManager::setState(uint8_t target, bool enabled)
 {
-  m_BoardConfig.enabled = enabled;
+  if(target >= m_BoardConfig.targetCount)
+    return;
+  CONFIG_LOCK();
+  m_BoardConfig.targets[target].enabled = enabled;
+  m_generation++;
+  CONFIG_UNLOCK();
+  markConfigDirty();
+}
+
+void ConfigManager::markConfigDirty()
+{
+  CONFIG_LOCK();
+  m_lastChange = millis();
+  if(!m_configDirty)
+    m_dirtySince = m_lastChange;
+  m_configDirty = true;
+  CONFIG_UNLOCK();
+}
+
+void ConfigManager::iterate(unsigned long currentTime)
+{
+  if(!m_configDirty)
+    return;
+  // wait for a burst of changes to settle, but not forever
+  if(currentTime - m_lastChange < CONFIG_SAVE_DEBOUNCE_MS && currentTime - m_dirtySince < CONFIG_SAVE_MAX_DELAY_MS)
+    return;
+  saveConfig();
 }
 
 void ConfigManager::printConfig()
@@ -122,38 +252,53 @@ void ConfigManager::printConfig()
 //#if PRINT_DEBUG
   char buf[256];
   MemLogger::instance()->logMessage("=CM: ================ CURRENT CONFIG ===================\n");
-  sprintf(buf,"=CM: BoardConfig.chipId:            %d \n", m_BoardConfig.chipId); MemLogger::instance()->logMessage(buf);
-  sprintf(buf,"=CM: BoardConfig.configVersion      %d \n", m_BoardConfig.configVersion); MemLogger::instance()->logMessage(buf);
-  sprintf(buf,"=CM: BoardConfig.resetWifiSettings  %d \n", m_BoardConfig.resetWifiSettings); MemLogger::instance()->logMessage(buf);
-  sprintf(buf,"=CM: BoardConfig.serverPort         %d \n", m_BoardConfig.serverPort); MemLogger::instance()->logMessage(buf);
+  MemLogger::instance()->logEvent(LOGMSG_CM_CHIPID, m_BoardConfig.chipId);
+  MemLogger::instance()->logEvent(LOGMSG_CM_CONFIGVERSION, m_BoardConfig.configVersion);
+  MemLogger::instance()->logEvent(LOGMSG_CM_RESETWIFI, m_BoardConfig.resetWifiSettings);
+  MemLogger::instance()->logEvent(LOGMSG_CM_SERVERPORT, m_BoardConfig.serverPort);
   sprintf(buf,"=CM: BoardConfig.hotSpotName:       %s \n", m_BoardConfig.hotSpotName.c_str()); MemLogger::instance()->logMessage(buf);
   sprintf(buf,"=CM: BoardConfig.hotSpotPwd         %s \n", m_BoardConfig.hotSpotPwd.c_str()); MemLogger::instance()->logMessage(buf);
   sprintf(buf,"=CM: BoardConfig.wifiName           %s \n", m_BoardConfig.wifiName.c_str()); MemLogger::instance()->logMessage(buf);
   sprintf(buf,"=CM: BoardConfig.wifiPwd            %s \n", m_BoardConfig.wifiPwd.c_str()); MemLogger::instance()->logMessage(buf);
-  sprintf(buf,"=CM: BoardConfig.lockupTime:        %d \n", m_BoardConfig.lockupTime); MemLogger::instance()->logMessage(buf);
-  sprintf(buf,"=CM: BoardConfig.cooldownTime       %d \n", m_BoardConfig.cooldownTime); MemLogger::instance()->logMessage(buf);
-  sprintf(buf,"=CM: BoardConfig.heartBeatCnt       %d \n", m_BoardConfig.heartBeatCnt); MemLogger::instance()->logMessage(buf);
-  sprintf(buf,"=CM: BoardConfig.enabled            %d \n", m_BoardConfig.enabled); MemLogger::instance()->logMessage(buf);
+  MemLogger::instance()->logEvent(LOGMSG_CM_TARGETCOUNT, m_BoardConfig.targetCount);
+  for(int t = 0; t < m_BoardConfig.targetCount; t++)
+  {
+    const TargetConfig& target = m_BoardConfig.targets[t];
+    MemLogger::instance()->logEvent(LOGMSG_CM_HEARTBEATPIN, t, target.heartBeatPin);
+    MemLogger::instance()->logEvent(LOGMSG_CM_POWERWATCHPIN, t, target.powerWatchPin);
+    MemLogger::instance()->logEvent(LOGMSG_CM_RESETPIN, t, target.resetPin);
+    MemLogger::instance()->logEvent(LOGMSG_CM_POWERPIN, t, target.powerPin);
+    MemLogger::instance()->logEvent(LOGMSG_CM_LOCKUPTIME, t, target.lockupTime);
+    MemLogger::instance()->logEvent(LOGMSG_CM_COOLDOWNTIME, t, target.cooldownTime);
+    MemLogger::instance()->logEvent(LOGMSG_CM_HEARTBEATCNT, t, target.heartBeatCnt);
+    MemLogger::instance()->logEvent(LOGMSG_CM_ENABLED, t, target.enabled);
+    MemLogger::instance()->logEvent(LOGMSG_CM_PROBES, t, target.probes);
+    MemLogger::instance()->logEvent(LOGMSG_CM_QUORUM, t, target.quorum);
+  }
   MemLogger::instance()->logMessage("=CM: ================ CURRENT CONFIG ===================\n");
 //#endif
 }
 
-void ConfigManager::deleteConfigFile()
+void ConfigManager::deleteConfig()
 {
+  m_configDirty = false;
+  m_slot = -1;
+  Preferences prefs;
+  if(prefs.begin(CONFIG_NVS_NAMESPACE, false))
+  {
+    prefs.clear();
+    prefs.end();
+    MemLogger::instance()->logMessage("=CM: Config record deleted!\n");
+  }
+
+  // or it would be migrated again on the next boot
   MemLogger::instance()->logMessage("=CM: Searching config file...\n");
-  if (LITTLEFS.begin())
+  if (Storage::instance()->mount())
   {
-    MemLogger::instance()->logMessage("=CM: Config file deleted!\n");
-    if(LITTLEFS.exists(CONFIGFILE_DEFAULT_NAME))
-      LITTLEFS.remove(CONFIGFILE_DEFAULT_NAME);
+    if(Storage::instance()->remove(CONFIGFILE_DEFAULT_NAME))
+      MemLogger::instance()->logMessage("=CM: Config file deleted!\n");
     else
       MemLogger::instance()->logMessage("=CM: Config file not found!\n");
-
-    LITTLEFS.end();
-  }
-  else
-  {
-    MemLogger::instance()->logMessage("=CM: File System issue!\n");
   }
 }
 
@@ -176,64 +321,116 @@ Config* ConfigManager::getConfig(CONFIG_TYPE type)
   return ptr;
 }
 
-bool ConfigManager::saveConfigToFile()
+bool ConfigManager::saveConfig()
 {
-  MemLogger::instance()->logMessage("=CM: Saving Config File...\n");
-  if (LITTLEFS.begin())
+  ConfigRecord rec;
+  CONFIG_LOCK();
+  // changes from here on mark the config dirty again
+  m_configDirty = false;
+  m_BoardConfig.configVersion++;
+  m_generation++;
+  bool packed = packConfig(m_BoardConfig, rec);
+  CONFIG_UNLOCK();
+  if(!packed)
   {
-    MemLogger::instance()->logMessage("=CM: Mounted file system\n");
-    // parse json config file
-    File configFile = LITTLEFS.open(CONFIGFILE_DEFAULT_NAME, "w");
-    if (configFile)
-    {
-      //try
-      //{
-        size_t size;
-        char* buf = getConfigJson(size);
-        configFile.write(reinterpret_cast<uint8_t*>(buf), size);
-      //}
-      //catch(...)
-      //{
-      //  Serial.println("=CM: Error writing JSON file!");
-      //}
-      configFile.close();
-    }
-    else {
-      MemLogger::instance()->logMessage("=CM: JSON Config file write failed!\n");
-      return false;
-    }
-    LITTLEFS.end();
+    MemLogger::instance()->logMessage("=CM: Config does not fit the record, SSID, password or health check path too long!\n");
+    return false;
   }
-  else
+  if(!writeRecord(rec))
   {
-    MemLogger::instance()->logMessage("=CM: File System issue!\n");
+    // try again with the next change or once the delay is over
+    markConfigDirty();
     return false;
   }
   return true;
 }
 
-char* ConfigManager::getConfigJson(size_t &size){
+// into the slot not holding the current record, which stays intact until
+// this write has succeeded
+bool ConfigManager::writeRecord(const ConfigRecord& rec)
+{
+  Preferences prefs;
+  if(!prefs.begin(CONFIG_NVS_NAMESPACE, false))
+  {
+    MemLogger::instance()->logMessage("=CM: NVS issue!\n");
+    return false;
+  }
+  int slot = (m_slot + 1) % CONFIG_NVS_SLOTS;
+  char key[16];
+  slotKey(key, sizeof(key), slot);
+  size_t size = prefs.putBytes(key, &rec, sizeof(rec));
+  // the slots take over from the single record of earlier firmware
+  if(size == sizeof(rec) && prefs.getBytesLength(CONFIG_NVS_KEY))
+    prefs.remove(CONFIG_NVS_KEY);
+  prefs.end();
+  if(size != sizeof(rec))
+  {
+    MemLogger::instance()->logMessage("=CM: Config record write failed!\n");
+    return false;
+  }
+  m_slot = slot;
+  MemLogger::instance()->logEvent(LOGMSG_CM_SAVED, slot, size);
+  Metrics::instance()->count(METRIC_CONFIG_SAVES);
+  return true;
+}
 
-  DynamicJsonDocument config(CONFIGFILE_DEFAULT_SIZE);
+ConfigJsonPtr ConfigManager::getConfigJson()
+{
+  CONFIG_LOCK();
+  if(m_json && m_json->generation == m_generation)
+  {
+    ConfigJsonPtr json = m_json;
+    CONFIG_UNLOCK();
+    return json;
+  }
 
+  DynamicJsonDocument config(CONFIGFILE_DEFAULT_SIZE);
   config["BoardConfig"]["chipId"] =             m_BoardConfig.chipId;
-  config["BoardConfig"]["configVersion"] =      m_BoardConfig.configVersion + 1;
+  config["BoardConfig"]["configVersion"] =      m_BoardConfig.configVersion;
   config["BoardConfig"]["resetWifiSettings"] =  m_BoardConfig.resetWifiSettings;
   config["BoardConfig"]["serverPort"] =         m_BoardConfig.serverPort;
   config["BoardConfig"]["hotSpotName"] =        m_BoardConfig.hotSpotName;
   config["BoardConfig"]["hotSpotPwd"] =         m_BoardConfig.hotSpotPwd;
   config["BoardConfig"]["wifiName"] =           m_BoardConfig.wifiName;
   config["BoardConfig"]["wifiPwd"] =            m_BoardConfig.wifiPwd;
-  config["BoardConfig"]["lockupTime"] =         m_BoardConfig.lockupTime;
-  config["BoardConfig"]["cooldownTime"] =       m_BoardConfig.cooldownTime;
-  config["BoardConfig"]["heartBeatCnt"] =       m_BoardConfig.heartBeatCnt;
-  config["BoardConfig"]["enabled"] =            m_BoardConfig.enabled;
-
+  config["BoardConfig"]["consoleBaud"] =        m_BoardConfig.consoleBaud;
 
-  std::unique_ptr<char[]> buf(new char[CONFIGFILE_DEFAULT_SIZE]);
-  size = serializeJson(config,buf.get(),CONFIGFILE_DEFAULT_SIZE);
+  JsonArray targets = config.createNestedArray("Targets");
+  for(int t = 0; t < m_BoardConfig.targetCount; t++)
+  {
+    const TargetConfig& src = m_BoardConfig.targets[t];
+    JsonObject target = targets.createNestedObject();
+    target["heartBeatPin"] =                    src.heartBeatPin;
+    target["powerWatchPin"] =                   src.powerWatchPin;
+    target["resetPin"] =                        src.resetPin;
+    target["powerPin"] =                        src.powerPin;
+    target["lockupTime"] =                      src.lockupTime;
+    target["cooldownTime"] =                    src.cooldownTime;
+    target["heartBeatCnt"] =                    src.heartBeatCnt;
+    target["enabled"] =                         src.enabled;
+    target["probes"] =                          src.probes;
+    target["quorum"] =                          src.quorum;
+    target["probeAddress"] =                    src.probeAddress ? IPAddress(src.probeAddress).toString() : String("");
+    target["udpPort"] =                         src.udpPort;
+    target["httpPort"] =                        src.httpPort;
+    target["httpPath"] =                        src.httpPath;
+    target["probeInterval"] =                   src.probeInterval;
+    target["udpTimeout"] =                      src.udpTimeout;
+    target["icmpTimeout"] =                     src.icmpTimeout;
+    target["httpTimeout"] =                     src.httpTimeout;
+  }
 
-  return buf.get();
+  ConfigJson* json = new ConfigJson();
+  json->generation = m_generation;
+  json->size = measureJson(config);
+  json->data.reset(new char[json->size + 1]);
+  serializeJson(config, json->data.get(), json->size + 1);
+  snprintf(json->etag, sizeof(json->etag), "\"%08x\"", (unsigned)configCrc(json->data.get(), json->size));
+  m_json.reset(json);
+  ConfigJsonPtr result = m_json;
+  CONFIG_UNLOCK();
+  Metrics::instance()->count(METRIC_CONFIG_JSON_BUILDS);
+  return result;
 }
 
 void ConfigManager::setConfigJson(const char* val)
@@ -243,21 +440,32 @@ void ConfigManager::setConfigJson(const char* val)
     DynamicJsonDocument config(CONFIGFILE_DEFAULT_SIZE);
     if(DeserializationError::Ok == deserializeJson(config, val))
     {
-      config["BoardConfig"].containsKey("serverPort")         ? m_BoardConfig.serverPort   = config["BoardConfig"]["serverPort"] : 0 ;
-
-      config["BoardConfig"].containsKey("hotSpotName")        ? m_BoardConfig.hotSpotName  = config["BoardConfig"]["hotSpotName"].as<String>() : "" ;
-      config["BoardConfig"].containsKey("hotSpotPwd")         ? m_BoardConfig.hotSpotPwd   = config["BoardConfig"]["hotSpotPwd"].as<String>() : "" ;
-      config["BoardConfig"].containsKey("wifiName")           ? m_BoardConfig.wifiName     = config["BoardConfig"]["wifiName"].as<String>() : "" ;
-      config["BoardConfig"].containsKey("wifiPwd")            ? m_BoardConfig.wifiPwd      = config["BoardConfig"]["wifiPwd"].as<String>() : "" ;
-
-      config["BoardConfig"].containsKey("lockupTime")         ? m_BoardConfig.lockupTime   = config["BoardConfig"]["lockupTime"] : 0;
-      config["BoardConfig"].containsKey("cooldownTime")       ? m_BoardConfig.cooldownTime = config["BoardConfig"]["cooldownTime"] : 0;
-      config["BoardConfig"].containsKey("heartBeatCnt")       ? m_BoardConfig.heartBeatCnt = config["BoardConfig"]["heartBeatCnt"] : 0;
-
-      config["BoardConfig"].containsKey("enabled")            ? m_BoardConfig.enabled      = config["BoardConfig"]["enabled"] : 1;
-
-      saveConfigToFile();
-      MemLogger::instance()->logMessage("=CM: JSON Config file written successfully!\n");
+      // applied as a whole or not at all
+      CONFIG_LOCK();
+      BoardConfig candidate = m_BoardConfig;
+      config["BoardConfig"].containsKey("serverPort")         ? candidate.serverPort   = config["BoardConfig"]["serverPort"] : 0 ;
+
+      config["BoardConfig"].containsKey("hotSpotName")        ? candidate.hotSpotName  = config["BoardConfig"]["hotSpotName"].as<String>() : "" ;
+      config["BoardConfig"].containsKey("hotSpotPwd")         ? candidate.hotSpotPwd   = config["BoardConfig"]["hotSpotPwd"].as<String>() : "" ;
+      config["BoardConfig"].containsKey("wifiName")           ? candidate.wifiName     = config["BoardConfig"]["wifiName"].as<String>() : "" ;
+      config["BoardConfig"].containsKey("wifiPwd")            ? candidate.wifiPwd      = config["BoardConfig"]["wifiPwd"].as<String>() : "" ;
+      config["BoardConfig"].containsKey("consoleBaud")        ? candidate.consoleBaud  = config["BoardConfig"]["consoleBaud"] : 0 ;
+
+      readTargets(config, candidate);
+
+      ConfigRecord rec;
+      bool fits = packConfig(candidate, rec);
+      if(fits)
+      {
+        m_BoardConfig = candidate;
+        m_generation++;
+      }
+      CONFIG_UNLOCK();
+
+      if(fits)
+        markConfigDirty();
+      else
+        MemLogger::instance()->logMessage("=CM: Config does not fit the record, SSID, password or health check path too long!\n");
     }
     else
     {
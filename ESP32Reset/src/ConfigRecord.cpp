@@ -0,0 +1,182 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <ConfigRecord.h>
+
+#include <stddef.h>
+
+// CRC-32 (IEEE) with a nibble table, small enough to stay in cache
+static const uint32_t s_crcNibbles[16] = {
+  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+uint32_t configCrc(const void* data, size_t size)
+{
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+  uint32_t crc = 0xFFFFFFFF;
+  while(size--)
+  {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ s_crcNibbles[crc & 0x0F];
+    crc = (crc >> 4) ^ s_crcNibbles[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+#define CONFIG_RECORD_V1_SIZE offsetof(ConfigRecord, consoleBaud)
+#define CONFIG_RECORD_V2_SIZE offsetof(ConfigRecord, probes)
+
+static uint32_t recordCrc(const ConfigRecord& rec)
+{
+  size_t offset = offsetof(ConfigRecord, crc) + sizeof(rec.crc);
+  return configCrc(reinterpret_cast<const uint8_t*>(&rec) + offset, rec.size - offset);
+}
+
+static bool packString(char* dst, size_t size, const String& src)
+{
+  if(src.length() >= size)
+    return false;
+  memset(dst, 0, size);
+  memcpy(dst, src.c_str(), src.length());
+  return true;
+}
+
+bool packConfig(const BoardConfig& cfg, ConfigRecord& rec)
+{
+  memset(&rec, 0, sizeof(rec));
+  rec.magic = CONFIG_RECORD_MAGIC;
+  rec.version = CONFIG_RECORD_VERSION;
+  rec.size = sizeof(rec);
+
+  rec.chipId = cfg.chipId;
+  rec.configVersion = cfg.configVersion;
+  rec.resetWifiSettings = cfg.resetWifiSettings;
+  rec.serverPort = cfg.serverPort;
+  if(!packString(rec.hotSpotName, sizeof(rec.hotSpotName), cfg.hotSpotName) ||
+     !packString(rec.hotSpotPwd, sizeof(rec.hotSpotPwd), cfg.hotSpotPwd) ||
+     !packString(rec.wifiName, sizeof(rec.wifiName), cfg.wifiName) ||
+     !packString(rec.wifiPwd, sizeof(rec.wifiPwd), cfg.wifiPwd))
+    return false;
+
+  rec.consoleBaud = cfg.consoleBaud;
+  rec.targetCount = cfg.targetCount;
+  for(int t = 0; t < MAX_TARGETS; t++)
+  {
+    const TargetConfig& src = cfg.targets[t];
+    TargetRecord& dst = rec.targets[t];
+    dst.heartBeatPin = src.heartBeatPin;
+    dst.powerWatchPin = src.powerWatchPin;
+    dst.resetPin = src.resetPin;
+    dst.powerPin = src.powerPin;
+    dst.lockupTime = src.lockupTime;
+    dst.cooldownTime = src.cooldownTime;
+    dst.heartBeatCnt = src.heartBeatCnt;
+    dst.enabled = src.enabled;
+
+    ProbeRecord& probe = rec.probes[t];
+    probe.probes = src.probes;
+    probe.quorum = src.quorum;
+    probe.address = src.probeAddress;
+    probe.udpPort = src.udpPort;
+    probe.httpPort = src.httpPort;
+    if(!packString(probe.httpPath, sizeof(probe.httpPath), src.httpPath))
+      return false;
+    probe.interval = src.probeInterval;
+    probe.udpTimeout = src.udpTimeout;
+    probe.icmpTimeout = src.icmpTimeout;
+    probe.httpTimeout = src.httpTimeout;
+  }
+  rec.crc = recordCrc(rec);
+  return true;
+}
+
+bool unpackConfig(const ConfigRecord& rec, BoardConfig& cfg)
+{
+  if(rec.magic != CONFIG_RECORD_MAGIC)
+    return false;
+  if(!(rec.version == CONFIG_RECORD_VERSION && rec.size == sizeof(rec)) &&
+     !(rec.version == 2 && rec.size == CONFIG_RECORD_V2_SIZE) &&
+     !(rec.version == 1 && rec.size == CONFIG_RECORD_V1_SIZE))
+    return false;
+  if(rec.crc != recordCrc(rec))
+    return false;
+  if(rec.targetCount < 1 || rec.targetCount > MAX_TARGETS)
+    return false;
+  // packString keeps a terminator, a record that lacks one is corrupt
+  if(rec.hotSpotName[sizeof(rec.hotSpotName) - 1] || rec.hotSpotPwd[sizeof(rec.hotSpotPwd) - 1] ||
+     rec.wifiName[sizeof(rec.wifiName) - 1] || rec.wifiPwd[sizeof(rec.wifiPwd) - 1])
+    return false;
+  if(rec.version >= 3)
+    for(int t = 0; t < MAX_TARGETS; t++)
+      if(rec.probes[t].httpPath[sizeof(rec.probes[t].httpPath) - 1])
+        return false;
+
+  cfg.chipId = rec.chipId;
+  cfg.configVersion = rec.configVersion;
+  cfg.resetWifiSettings = rec.resetWifiSettings;
+  cfg.serverPort = rec.serverPort;
+  cfg.hotSpotName = rec.hotSpotName;
+  cfg.hotSpotPwd = rec.hotSpotPwd;
+  cfg.wifiName = rec.wifiName;
+  cfg.wifiPwd = rec.wifiPwd;
+  cfg.consoleBaud = rec.version >= 2 ? rec.consoleBaud : DEFAULT_CONSOLE_BAUD;
+
+  cfg.targetCount = rec.targetCount;
+  for(int t = 0; t < MAX_TARGETS; t++)
+  {
+    const TargetRecord& src = rec.targets[t];
+    TargetConfig& dst = cfg.targets[t];
+    dst.heartBeatPin = src.heartBeatPin;
+    dst.powerWatchPin = src.powerWatchPin;
+    dst.resetPin = src.resetPin;
+    dst.powerPin = src.powerPin;
+    dst.lockupTime = src.lockupTime;
+    dst.cooldownTime = src.cooldownTime;
+    dst.heartBeatCnt = src.heartBeatCnt;
+    dst.enabled = src.enabled;
+
+    // older records only know the heartbeat pin
+    TargetConfig defaults;
+    const ProbeRecord& probe = rec.probes[t];
+    bool known = rec.version >= 3;
+    dst.probes = known ? probe.probes : defaults.probes;
+    dst.quorum = known ? probe.quorum : defaults.quorum;
+    dst.probeAddress = known ? probe.address : defaults.probeAddress;
+    dst.udpPort = known ? probe.udpPort : defaults.udpPort;
+    dst.httpPort = known ? probe.httpPort : defaults.httpPort;
+    dst.httpPath = known ? probe.httpPath : defaults.httpPath;
+    dst.probeInterval = known ? probe.interval : defaults.probeInterval;
+    dst.udpTimeout = known ? probe.udpTimeout : defaults.udpTimeout;
+    dst.icmpTimeout = known ? probe.icmpTimeout : defaults.icmpTimeout;
+    dst.httpTimeout = known ? probe.httpTimeout : defaults.httpTimeout;
+  }
+  return true;
+}
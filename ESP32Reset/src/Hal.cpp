@@ -0,0 +1,150 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <Hal.h>
+
+Hal* Hal::s_hal = 0;
+void* Hal::s_watchdogTask = 0;
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#include <esp_timer.h>
+
+class ArduinoHal : public Hal
+{
+public:
+  ArduinoHal ()
+  {
+    for(int i = 0; i < HAL_MAXTIMERS; i++)
+    {
+      m_timers[i] = NULL;
+      m_callbacks[i] = NULL;
+    }
+  }
+
+  void pinMode(uint8_t pin, uint8_t mode) { ::pinMode(pin, mode); }
+  int digitalRead(uint8_t pin) { return ::digitalRead(pin); }
+  void digitalWrite(uint8_t pin, uint8_t val) { ::digitalWrite(pin, val); }
+  unsigned long millis() { return ::millis(); }
+  void delay(unsigned long ms) { ::delay(ms); }
+  void yield() { ::yield(); }
+
+  unsigned long micros() { return ::micros(); }
+  void attachInterrupt(uint8_t pin, void (*isr)(void*), void* arg, int mode) { ::attachInterruptArg(digitalPinToInterrupt(pin), isr, arg, mode); }
+  void armTimer(HAL_TIMER timer, uint64_t us, void (*callback)())
+  {
+    if(!m_timers[timer])
+    {
+      esp_timer_create_args_t args = {};
+      args.callback = &ArduinoHal::onTimer;
+      args.arg = &m_callbacks[timer];
+      args.name = "hal";
+      esp_timer_create(&args, &m_timers[timer]);
+    }
+    esp_timer_stop(m_timers[timer]);
+    m_callbacks[timer] = callback;
+    esp_timer_start_once(m_timers[timer], us);
+  }
+private:
+  static void onTimer(void* arg)
+  {
+    void (*callback)() = *reinterpret_cast<void (**)()>(arg);
+    if(callback)
+      callback();
+  }
+
+  esp_timer_handle_t        m_timers[HAL_MAXTIMERS];
+  void                      (*m_callbacks[HAL_MAXTIMERS])();
+};
+
+uint32_t IRAM_ATTR Hal::isrMicros()
+{
+  return ::micros();
+}
+
+uint32_t IRAM_ATTR Hal::isrMillis()
+{
+  return ::millis();
+}
+
+void IRAM_ATTR Hal::wakeWatchdog()
+{
+  TaskHandle_t task = reinterpret_cast<TaskHandle_t>(s_watchdogTask);
+  if(!task)
+    return;
+  if(xPortInIsrContext())
+  {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(task, &woken);
+    if(woken)
+      portYIELD_FROM_ISR();
+  }
+  else
+    xTaskNotifyGive(task);
+}
+
+Hal* Hal::instance()
+{
+  if(!s_hal)
+    s_hal = new ArduinoHal();
+  return s_hal;
+}
+#else
+// off target there is no default, the simulator has to install one
+Hal* Hal::instance()
+{
+  return s_hal;
+}
+
+uint32_t Hal::isrMicros()
+{
+  return s_hal->micros();
+}
+
+uint32_t Hal::isrMillis()
+{
+  return s_hal->millis();
+}
+
+// the simulator runs everything in one thread
+void Hal::wakeWatchdog()
+{
+}
+#endif
+
+void Hal::install(Hal* hal)
+{
+  s_hal = hal;
+}
+
+void Hal::setWatchdogTask(void* task)
+{
+  s_watchdogTask = task;
+}
@@ -0,0 +1,137 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <string.h>
+
+#include <IntervalStats.h>
+
+// values below INTERVALSTATS_SUBBUCKETS get a bucket each, above that every
+// power of two [2^k, 2^(k+1)) is split into INTERVALSTATS_SUBBUCKETS
+// equally wide buckets
+static_assert(INTERVALSTATS_SUBBUCKETS == 4, "bucket math assumes 4 sub-buckets");
+
+void IntervalStats::reset()
+{
+  m_count = 0;
+  m_min = UINT32_MAX;
+  m_max = 0;
+  m_mean = 0.0;
+  m_m2 = 0.0;
+  memset(m_buckets, 0, sizeof(m_buckets));
+}
+
+int IntervalStats::bucketOf(uint32_t value)
+{
+  if(value < INTERVALSTATS_SUBBUCKETS)
+    return value;
+  int k = 31 - __builtin_clz(value);
+  int sub = (value >> (k - 2)) & (INTERVALSTATS_SUBBUCKETS - 1);
+  return INTERVALSTATS_SUBBUCKETS * (k - 1) + sub;
+}
+
+uint32_t IntervalStats::bucketLower(int bucket)
+{
+  if(bucket < INTERVALSTATS_SUBBUCKETS)
+    return bucket;
+  int k = bucket / INTERVALSTATS_SUBBUCKETS + 1;
+  int sub = bucket % INTERVALSTATS_SUBBUCKETS;
+  return (uint32_t)(INTERVALSTATS_SUBBUCKETS + sub) << (k - 2);
+}
+
+uint64_t IntervalStats::bucketUpper(int bucket)
+{
+  if(bucket < INTERVALSTATS_SUBBUCKETS)
+    return bucket + 1;
+  int k = bucket / INTERVALSTATS_SUBBUCKETS + 1;
+  return (uint64_t)bucketLower(bucket) + ((uint64_t)1 << (k - 2));
+}
+
+void IntervalStats::add(uint32_t value)
+{
+  m_count++;
+  if(value < m_min)
+    m_min = value;
+  if(value > m_max)
+    m_max = value;
+  double delta = value - m_mean;
+  m_mean += delta / m_count;
+  m_m2 += delta * (value - m_mean);
+  m_buckets[bucketOf(value)]++;
+}
+
+void IntervalStats::merge(const IntervalStats& other)
+{
+  if(!other.m_count)
+    return;
+  if(!m_count)
+  {
+    *this = other;
+    return;
+  }
+  // parallel variant of Welford's update (Chan et al.)
+  double count = (double)m_count + other.m_count;
+  double delta = other.m_mean - m_mean;
+  m_mean += delta * other.m_count / count;
+  m_m2 += other.m_m2 + delta * delta * m_count * other.m_count / count;
+  m_count += other.m_count;
+  if(other.m_min < m_min)
+    m_min = other.m_min;
+  if(other.m_max > m_max)
+    m_max = other.m_max;
+  for(int i = 0; i < INTERVALSTATS_BUCKETS; i++)
+    m_buckets[i] += other.m_buckets[i];
+}
+
+uint32_t IntervalStats::percentile(double q) const
+{
+  if(!m_count)
+    return 0;
+  // interpolate linearly within the bucket holding the q-th sample
+  double target = q * m_count;
+  double cumulative = 0.0;
+  for(int i = 0; i < INTERVALSTATS_BUCKETS; i++)
+  {
+    if(!m_buckets[i])
+      continue;
+    if(cumulative + m_buckets[i] >= target)
+    {
+      double lower = bucketLower(i);
+      double upper = (double)bucketUpper(i);
+      double value = lower + (upper - lower) * (target - cumulative) / m_buckets[i];
+      if(value < m_min)
+        value = m_min;
+      if(value > m_max)
+        value = m_max;
+      return (uint32_t)value;
+    }
+    cumulative += m_buckets[i];
+  }
+  return m_max;
+}
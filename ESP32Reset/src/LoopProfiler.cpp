@@ -0,0 +1,131 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <Arduino.h>
+
+#include <LoopProfiler.h>
+
+#if LOOP_PROFILER
+
+// one lock per lane, so the two tasks never wait for each other
+static portMUX_TYPE s_profMux[MAXPROFLANES] = { portMUX_INITIALIZER_UNLOCKED, portMUX_INITIALIZER_UNLOCKED };
+
+static const char* s_sectionNames[MAXPROFSECTIONS] = {
+  "pulses", "checker", "buttons", "logger", "storage", "idle"
+};
+
+static const PROF_LANE s_sectionLanes[MAXPROFSECTIONS] = {
+  PROF_LANE_WATCHDOG, PROF_LANE_WATCHDOG, PROF_LANE_SERVICE, PROF_LANE_SERVICE,
+  PROF_LANE_SERVICE, PROF_LANE_SERVICE
+};
+
+static const char* s_laneNames[MAXPROFLANES] = { "watchdog", "service" };
+
+LoopProfiler::LoopProfiler()
+{
+  for(int i = 0; i < MAXPROFLANES; i++)
+  {
+    m_mark[i] = 0;
+    m_begin[i] = 0;
+    m_started[i] = false;
+  }
+}
+
+void LoopProfiler::begin(PROF_LANE lane)
+{
+  uint32_t now = ESP.getCycleCount();
+  if(m_started[lane])
+  {
+    portENTER_CRITICAL(&s_profMux[lane]);
+    m_period[lane].add(now - m_begin[lane]);
+    portEXIT_CRITICAL(&s_profMux[lane]);
+  }
+  m_started[lane] = true;
+  m_begin[lane] = now;
+  m_mark[lane] = now;
+}
+
+void LoopProfiler::mark(PROF_SECTION section)
+{
+  // the cycle counters of the two cores are not in sync, this only works
+  // because every lane belongs to a task pinned to one core
+  PROF_LANE lane = s_sectionLanes[section];
+  uint32_t now = ESP.getCycleCount();
+  portENTER_CRITICAL(&s_profMux[lane]);
+  m_sections[section].add(now - m_mark[lane]);
+  portEXIT_CRITICAL(&s_profMux[lane]);
+  // the stats update is charged to the next section, it is the same for all
+  m_mark[lane] = now;
+}
+
+void LoopProfiler::section(PROF_SECTION section, IntervalStats& out)
+{
+  PROF_LANE lane = s_sectionLanes[section];
+  portENTER_CRITICAL(&s_profMux[lane]);
+  out = m_sections[section];
+  portEXIT_CRITICAL(&s_profMux[lane]);
+}
+
+void LoopProfiler::period(PROF_LANE lane, IntervalStats& out)
+{
+  portENTER_CRITICAL(&s_profMux[lane]);
+  out = m_period[lane];
+  portEXIT_CRITICAL(&s_profMux[lane]);
+}
+
+void LoopProfiler::reset()
+{
+  for(int lane = 0; lane < MAXPROFLANES; lane++)
+  {
+    portENTER_CRITICAL(&s_profMux[lane]);
+    for(int i = 0; i < MAXPROFSECTIONS; i++)
+      if(s_sectionLanes[i] == lane)
+        m_sections[i].reset();
+    m_period[lane].reset();
+    portEXIT_CRITICAL(&s_profMux[lane]);
+  }
+}
+
+uint32_t LoopProfiler::cyclesPerMicro() const
+{
+  return ESP.getCpuFreqMHz();
+}
+
+const char* LoopProfiler::sectionName(PROF_SECTION section)
+{
+  return s_sectionNames[section];
+}
+
+const char* LoopProfiler::laneName(PROF_LANE lane)
+{
+  return s_laneNames[lane];
+}
+
+#endif // LOOP_PROFILER
@@ -32,35 +32,329 @@
 
 #include <Constants.h>
 #include <MemLogger.h>
+#include <Hal.h>
+
+static_assert((MEMLOGGER_ARENA_SIZE & (MEMLOGGER_ARENA_SIZE - 1)) == 0, "MEMLOGGER_ARENA_SIZE must be a power of two");
+
+// the tasks that log directly or read the log take this spinlock, on both
+// cores: the service task, the web server task and setup. ISRs and the
+// watchdog task never do, they use the queues drained by iterate()
+#if defined(ARDUINO)
+static portMUX_TYPE s_logMux = portMUX_INITIALIZER_UNLOCKED;
+#define LOG_LOCK()      portENTER_CRITICAL(&s_logMux)
+#define LOG_UNLOCK()    portEXIT_CRITICAL(&s_logMux)
+#else
+#define LOG_LOCK()
+#define LOG_UNLOCK()
+#endif
+
+typedef struct
+{
+  const char* tag;
+  const char* format; // called with both arguments as long
+} LogFormat;
+
+// by LOG_MSG_ID, rendered as <tag>[hh:mm:ss.mmm] <format>
+static const LogFormat s_formats[MAXLOGMSGS] = {
+  { "=MAIN:", "Interrupt from Reset Button!\n" },
+  { "=MAIN:", "Reset Button ignored, a pulse is in progress!\n" },
+  { "=MAIN:", "Interrupt from Flash Button (%ld changes)!\n" },
+  { "=MAIN:", "Time Flash button pressed for %ld ms! Press %ld ms to reset!\n" },
+  { "=MAIN:", "Watchdog armed %ld us after boot\n" },
+  { "=SC:", "#%ld Cooldown active for another %ld seconds\n" },
+  { "=SC:", "#%ld Resetting cooldown timer!\n" },
+  { "=SC:", "#%ld Current Power Watch Status: on\n" },
+  { "=SC:", "#%ld Current Power Watch Status: off\n" },
+  { "=SC:", "#%ld Board locked up, %ld probes up!\n" },
+  { "=SC:", "#%ld Status is on!\n" },
+  { "=SC:", "#%ld Status is off!\n" },
+  { "=SC:", "#%ld Send power/reset combi!\n" },
+  { "=SC:", "#%ld Last value changed %ld ms ago!\n" },
+  { "=SC:", "Initializing Sanity Checker for %ld targets...\n" },
+  { "=SC:", "#%ld Enable WD\n" },
+  { "=SC:", "#%ld Disable WD\n" },
+  { "=SC:", "#%ld Executing RESET message (%ld ms)\n" },
+  { "=SC:", "#%ld Executing POWER message (%ld ms)\n" },
+  { "=SC:", "#%ld Ignoring POWER message\n" },
+  { "=SC:", "#%ld Power/reset combi done\n" },
+  { "=SC:", "#%ld Pulse queue full, recovery skipped!\n" },
+  { "=SC:", "#%ld Invalid pin mapping, target not supervised!\n" },
+  { "=CM:", "BoardConfig.chipId:            %ld\n" },
+  { "=CM:", "BoardConfig.configVersion      %ld\n" },
+  { "=CM:", "BoardConfig.resetWifiSettings  %ld\n" },
+  { "=CM:", "BoardConfig.serverPort         %ld\n" },
+  { "=CM:", "BoardConfig.targetCount        %ld\n" },
+  { "=CM:", "Target[%ld].heartBeatPin       %ld\n" },
+  { "=CM:", "Target[%ld].powerWatchPin      %ld\n" },
+  { "=CM:", "Target[%ld].resetPin           %ld\n" },
+  { "=CM:", "Target[%ld].powerPin           %ld\n" },
+  { "=CM:", "Target[%ld].lockupTime         %ld\n" },
+  { "=CM:", "Target[%ld].cooldownTime       %ld\n" },
+  { "=CM:", "Target[%ld].heartBeatCnt       %ld\n" },
+  { "=CM:", "Target[%ld].enabled            %ld\n" },
+  { "=CM:", "Target[%ld].probes             0x%02lx\n" },
+  { "=CM:", "Target[%ld].quorum             %ld\n" },
+  { "=CM:", "Config loaded from NVS in %ld us\n" },
+  { "=CM:", "Config migrated from JSON to NVS in %ld us\n" },
+  { "=CM:", "Config saved to NVS slot %ld (%ld bytes)\n" },
+  { "=SB:", "Console bridge running at %ld baud\n" },
+  { "=PS:", "#%ld Network probes running: 0x%02lx\n" },
+  { "=PS:", "#%ld Probe %ld could not be started!\n" }
+};
+
+SpscRing<IsrLogRecord, MEMLOGGER_ISR_QUEUE_SIZE> MemLogger::s_isrQueue;
+SpscRing<IsrLogRecord, MEMLOGGER_TASK_QUEUE_SIZE> MemLogger::s_taskQueue;
+
+// zigzag varint, small magnitudes of either sign take a single byte
+static size_t packArg(uint8_t* out, int32_t value)
+{
+  uint32_t zigzag = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+  size_t n = 0;
+  while(zigzag >= 0x80)
+  {
+    out[n++] = (uint8_t)(zigzag | 0x80);
+    zigzag >>= 7;
+  }
+  out[n++] = (uint8_t)zigzag;
+  return n;
+}
+
+static size_t unpackArg(const uint8_t* in, size_t len, int32_t& value)
+{
+  uint32_t zigzag = 0;
+  size_t n = 0;
+  for(int shift = 0; n < len && shift < 35; shift += 7)
+  {
+    uint8_t byte = in[n++];
+    zigzag |= (uint32_t)(byte & 0x7f) << shift;
+    if(!(byte & 0x80))
+      break;
+  }
+  value = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+  return n;
+}
 
 bool MemLogger::init()
 {
   return true;
 }
 
+void IRAM_ATTR MemLogger::logFromIsr(LOG_MSG_ID id, int32_t arg0, int32_t arg1)
+{
+  IsrLogRecord record;
+  record.millis = Hal::isrMillis();
+  record.id = id;
+  record.args[0] = arg0;
+  record.args[1] = arg1;
+  s_isrQueue.push(record);
+}
+
+void MemLogger::logDeferred(LOG_MSG_ID id, int32_t arg0, int32_t arg1)
+{
+  IsrLogRecord record;
+  record.millis = Hal::instance()->millis();
+  record.id = id;
+  record.args[0] = arg0;
+  record.args[1] = arg1;
+  s_taskQueue.push(record);
+}
+
 void MemLogger::iterate()
 {
+  IsrLogRecord record;
+  while(s_isrQueue.pop(record))
+    appendEvent(record.millis, record.id, record.args);
+  while(s_taskQueue.pop(record))
+    appendEvent(record.millis, record.id, record.args);
+
+  uint32_t dropped = queueDropped();
+  if(dropped != m_queueDropped)
+  {
+    char buf[64];
+    int len = snprintf(buf, sizeof(buf), "=LOG: %lu queued messages dropped\n", (unsigned long)(dropped - m_queueDropped));
+    logMessage(buf, len);
+    m_queueDropped = dropped;
+  }
   yield();
 }
 
-void MemLogger::logMessage(std::string message)
+void MemLogger::copyIn(uint32_t pos, const void* src, size_t len)
+{
+  uint32_t offset = pos & (MEMLOGGER_ARENA_SIZE - 1);
+  size_t first = MEMLOGGER_ARENA_SIZE - offset < len ? MEMLOGGER_ARENA_SIZE - offset : len;
+  memcpy(m_arena + offset, src, first);
+  memcpy(m_arena, reinterpret_cast<const uint8_t*>(src) + first, len - first);
+}
+
+void MemLogger::copyOut(void* dst, uint32_t pos, size_t len) const
 {
-  m_optimizedBuffer.push(message);
+  uint32_t offset = pos & (MEMLOGGER_ARENA_SIZE - 1);
+  size_t first = MEMLOGGER_ARENA_SIZE - offset < len ? MEMLOGGER_ARENA_SIZE - offset : len;
+  memcpy(dst, m_arena + offset, first);
+  memcpy(reinterpret_cast<uint8_t*>(dst) + first, m_arena, len - first);
+}
+
+uint16_t MemLogger::recordHeader(uint32_t pos) const
+{
+  uint16_t header;
+  copyOut(&header, pos, sizeof(header));
+  return header;
+}
+
+void MemLogger::append(uint16_t header, const void* payload, size_t len)
+{
+  uint32_t need = sizeof(header) + len;
+
+  LOG_LOCK();
+  // make room by dropping the oldest records
+  while(MEMLOGGER_ARENA_SIZE - (m_head - m_tail) < need)
+  {
+    m_tail += sizeof(header) + (recordHeader(m_tail) & ~MEMLOGGER_EVENT_FLAG);
+    m_firstSeq++;
+    m_evicted++;
+  }
+  copyIn(m_head, &header, sizeof(header));
+  copyIn(m_head + sizeof(header), payload, len);
+  m_head += need;
+  m_nextSeq++;
+  LOG_UNLOCK();
+}
+
+void MemLogger::logMessage(const char* msg)
+{
+  logMessage(msg, strlen(msg));
+}
+
+void MemLogger::logMessage(const char* msg, size_t len)
+{
+  if(len > MEMLOGGER_MAX_RECORD)
+    len = MEMLOGGER_MAX_RECORD;
+  append(len, msg, len);
+
+  #if PRINT_DEBUG
+    Serial.write(msg, len);
+  #endif
+}
+
+void MemLogger::logEvent(LOG_MSG_ID id, int32_t arg0, int32_t arg1)
+{
+  int32_t args[2] = { arg0, arg1 };
+  appendEvent(Hal::instance()->millis(), id, args);
+}
+
+void MemLogger::appendEvent(uint32_t millis, uint8_t id, const int32_t* args)
+{
+  // id, timestamp and the arguments up to the last one that is not zero
+  uint8_t payload[1 + sizeof(millis) + 2 * 5];
+  size_t len = 0;
+  payload[len++] = id;
+  memcpy(payload + len, &millis, sizeof(millis));
+  len += sizeof(millis);
+  int count = args[1] ? 2 : (args[0] ? 1 : 0);
+  for(int i = 0; i < count; i++)
+    len += packArg(payload + len, args[i]);
+  append(MEMLOGGER_EVENT_FLAG | len, payload, len);
+
   #if PRINT_DEBUG
-    Serial.printf(message.c_str());
+    char buf[MEMLOGGER_MAX_RECORD + 1];
+    Serial.write(buf, renderEvent(payload, len, buf, sizeof(buf)));
   #endif
 }
 
-const char* MemLogger::popLog()
+size_t MemLogger::renderEvent(const uint8_t* payload, size_t len, char* out, size_t size) const
+{
+  uint8_t id = payload[0];
+  uint32_t millis;
+  memcpy(&millis, payload + 1, sizeof(millis));
+  int32_t args[2] = { 0, 0 };
+  size_t pos = 1 + sizeof(millis);
+  for(int i = 0; i < 2 && pos < len; i++)
+    pos += unpackArg(payload + pos, len - pos, args[i]);
+
+  if(id >= MAXLOGMSGS)
+    return snprintf(out, size, "=LOG: unknown event %u\n", id);
+
+  unsigned long hour = millis / 3600000;
+  unsigned long minute = (millis / 60000) % 60;
+  unsigned long second = (millis / 1000) % 60;
+  unsigned long remainder = millis % 1000;
+  int n = snprintf(out, size, "%s[%02lu:%02lu:%02lu.%03lu] ", s_formats[id].tag, hour, minute, second, remainder);
+  if(n < 0 || (size_t)n >= size)
+    return size - 1;
+  int m = snprintf(out + n, size - n, s_formats[id].format, (long)args[0], (long)args[1]);
+  if(m < 0)
+    return n;
+  return (size_t)(n + m) < size ? n + m : size - 1;
+}
+
+size_t MemLogger::readSince(uint32_t& seq, char* out, size_t size, uint32_t until)
 {
-  std::string cur("");
-  cur.reserve(1024);
-  while(m_optimizedBuffer.size())
+  if(!size)
+    return 0;
+  size_t used = 0;
+  out[0] = '\0';
+
+  // skip what the reader has already seen, a few records per lock so
+  // interrupts are not held off for the length of the whole log
+  uint32_t pos = 0;
+  uint32_t cur = 0;
+  bool skipping = true;
+  while(skipping)
+  {
+    LOG_LOCK();
+    if(cur < m_firstSeq)
+    {
+      pos = m_tail;
+      cur = m_firstSeq;
+    }
+    for(int i = 0; i < MEMLOGGER_SKIP_BATCH && cur <= seq && pos != m_head; i++)
+    {
+      pos += sizeof(uint16_t) + (recordHeader(pos) & ~MEMLOGGER_EVENT_FLAG);
+      cur++;
+    }
+    skipping = cur <= seq && pos != m_head;
+    LOG_UNLOCK();
+  }
+
+  // copy one record at a time and render it outside of the lock; pos stays
+  // valid as long as record cur has not been evicted meanwhile
+  uint8_t raw[MEMLOGGER_MAX_RECORD];
+  char text[MEMLOGGER_MAX_RECORD + 1];
+  while(true)
   {
-      cur.insert(0,m_optimizedBuffer.pop().c_str());
+    LOG_LOCK();
+    if(cur < m_firstSeq)
+    {
+      pos = m_tail;
+      cur = m_firstSeq;
+    }
+    if(pos == m_head || cur > until)
+    {
+      LOG_UNLOCK();
+      break;
+    }
+    uint16_t header = recordHeader(pos);
+    uint16_t len = header & ~MEMLOGGER_EVENT_FLAG;
+    copyOut(raw, pos + sizeof(header), len);
+    LOG_UNLOCK();
+
+    const char* src = reinterpret_cast<const char*>(raw);
+    if(header & MEMLOGGER_EVENT_FLAG)
+    {
+      len = renderEvent(raw, len, text, sizeof(text));
+      src = text;
+    }
+    if(used + len + 1 > size)
+      break;
+    memcpy(out + used, src, len);
+    used += len;
+    pos += sizeof(header) + (header & ~MEMLOGGER_EVENT_FLAG);
+    seq = cur++;
   }
+
+  out[used] = '\0';
 #if PRINT_DEBUG && PRINT_VERBOSE
-  Serial.printf(cur.c_str());
+  Serial.print(out);
 #endif
-  return cur.c_str();
+  return used;
 }
@@ -0,0 +1,165 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <stdio.h>
+
+#include <Metrics.h>
+#include <MemLogger.h>
+
+#define METRICS_PREFIX "esp32reset_"
+
+typedef struct
+{
+  const char* name;
+  const char* help;
+} MetricDesc;
+
+static const MetricDesc s_counters[MAXMETRICS] = {
+  { "heartbeat_edges_total", "Heartbeat edges seen" },
+  { "lockups_total", "Lockups or power losses detected" },
+  { "reset_pulses_total", "Reset pulses issued" },
+  { "power_pulses_total", "Power pulses issued" },
+  { "cooldowns_total", "Cooldown periods entered" },
+  { "config_saves_total", "Config records written to NVS" },
+  { "config_json_builds_total", "Config serializations for /getconfig" },
+  { "console_rx_bytes_total", "Bytes received from the board console" },
+  { "console_fifo_overruns_total", "UART FIFO overruns, bytes were lost" },
+  { "console_ring_overruns_total", "UART receive ring overruns, bytes were lost" },
+  { "console_frame_errors_total", "UART framing or parity errors, check the baud rate" },
+  { "console_tx_bytes_total", "Bytes sent from the browser to the board console" },
+  { "console_input_dropped_bytes_total", "Browser input dropped because the transmit ring was full" },
+  { "probe_successes_total", "Network probes that found their target alive" },
+  { "probe_failures_total", "Pings and health checks that failed or got no answer in time" },
+  { "udp_heartbeats_lost_total", "Heartbeat datagrams missing from the sequence" }
+};
+
+static const char* s_routes[MAXROUTES] = {
+  "index", "asset", "saveconfig", "wdstate", "reset", "resetESP", "shutdown",
+  "getconfig", "fwversion", "hbstats", "powerstatus", "log", "logstream", "metrics",
+  "profile", "targets", "status"
+};
+
+static const char* s_dropReasons[2] = { "evicted", "queue" };
+
+static const MetricDesc s_gauges[MAXGAUGES] = {
+  { "uptime_seconds", "Seconds since boot" },
+  { "free_heap_bytes", "Free heap" },
+  { "min_free_heap_bytes", "Lowest free heap since boot" },
+  { "wifi_rssi_dbm", "WiFi signal strength, 0 without a station link" },
+  { "config_load_microseconds", "Time to load the config at boot" },
+  { "watchdog_armed_microseconds", "Time from boot until the watchdog was armed" }
+};
+
+Metrics::Metrics()
+{
+  for(int i = 0; i < MAXMETRICS; i++)
+    m_counters[i].store(0);
+  for(int i = 0; i < MAXROUTES; i++)
+    m_requests[i].store(0);
+}
+
+void Metrics::snapshot(MetricsSnapshot& snap) const
+{
+  for(int i = 0; i < MAXMETRICS; i++)
+    snap.counters[i] = m_counters[i].load(std::memory_order_relaxed);
+  for(int i = 0; i < MAXROUTES; i++)
+    snap.requests[i] = m_requests[i].load(std::memory_order_relaxed);
+  snap.logDropped[0] = MemLogger::instance()->evicted();
+  snap.logDropped[1] = MemLogger::queueDropped();
+  snap.targetCount = 0;
+}
+
+static size_t header(char* out, size_t size, int part, const char* name, const char* help, bool counter)
+{
+  if(part == 0)
+    return snprintf(out, size, "# HELP " METRICS_PREFIX "%s %s\n", name, help);
+  return snprintf(out, size, "# TYPE " METRICS_PREFIX "%s %s\n", name, counter ? "counter" : "gauge");
+}
+
+// families in order: counters and gauges take help, type and value lines,
+// the labelled ones help, type and one line per label
+size_t Metrics::renderLine(const MetricsSnapshot& snap, uint16_t line, char* out, size_t size)
+{
+  size_t len;
+  if(line < MAXMETRICS * 3)
+  {
+    const MetricDesc& desc = s_counters[line / 3];
+    if(line % 3 < 2)
+      len = header(out, size, line % 3, desc.name, desc.help, true);
+    else
+      len = snprintf(out, size, METRICS_PREFIX "%s %lu\n", desc.name, (unsigned long)snap.counters[line / 3]);
+    return len < size ? len : size - 1;
+  }
+  line -= MAXMETRICS * 3;
+
+  if(line < 2 + MAXROUTES)
+  {
+    if(line < 2)
+      len = header(out, size, line, "http_requests_total", "HTTP requests per route", true);
+    else
+      len = snprintf(out, size, METRICS_PREFIX "http_requests_total{route=\"%s\"} %lu\n",
+        s_routes[line - 2], (unsigned long)snap.requests[line - 2]);
+    return len < size ? len : size - 1;
+  }
+  line -= 2 + MAXROUTES;
+
+  if(line < 2 + 2)
+  {
+    if(line < 2)
+      len = header(out, size, line, "log_dropped_total", "Log records lost", true);
+    else
+      len = snprintf(out, size, METRICS_PREFIX "log_dropped_total{reason=\"%s\"} %lu\n",
+        s_dropReasons[line - 2], (unsigned long)snap.logDropped[line - 2]);
+    return len < size ? len : size - 1;
+  }
+  line -= 2 + 2;
+
+  if(line < MAXGAUGES * 3)
+  {
+    const MetricDesc& desc = s_gauges[line / 3];
+    if(line % 3 < 2)
+      len = header(out, size, line % 3, desc.name, desc.help, false);
+    else
+      len = snprintf(out, size, METRICS_PREFIX "%s %ld\n", desc.name, (long)snap.gauges[line / 3]);
+    return len < size ? len : size - 1;
+  }
+  line -= MAXGAUGES * 3;
+
+  if(line < 2 + snap.targetCount)
+  {
+    if(line < 2)
+      len = header(out, size, line, "watchdog_state", "0 disabled, 1 cooldown, 2 watching, 3 recovering", false);
+    else
+      len = snprintf(out, size, METRICS_PREFIX "watchdog_state{target=\"%d\"} %d\n",
+        line - 2, snap.targetStates[line - 2]);
+    return len < size ? len : size - 1;
+  }
+  return 0;
+}
@@ -0,0 +1,450 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <ProbeScheduler.h>
+#include <MemLogger.h>
+#include <Metrics.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(ARDUINO)
+#include <lwip/sockets.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#endif
+
+#define PROBE_ICMP_ID           0xE300 // | target, tells our echo requests apart
+#define PROBE_ICMP_ECHO         8
+#define PROBE_ICMP_ECHO_REPLY   0
+#define PROBE_RECV_BURST        8      // datagrams read per socket and pass
+
+typedef struct __attribute__((packed))
+{
+  uint8_t type;
+  uint8_t code;
+  uint16_t checksum;
+  uint16_t id;
+  uint16_t seq;
+  uint8_t payload[8];
+} IcmpEcho;
+
+static bool nonBlocking(int fd)
+{
+  int flags = fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// internet checksum of big-endian 16 bit words
+static uint16_t checksum(const uint8_t* data, size_t len)
+{
+  uint32_t sum = 0;
+  for(size_t i = 0; i + 1 < len; i += 2)
+    sum += (data[i] << 8) | data[i + 1];
+  if(len & 1)
+    sum += data[len - 1] << 8;
+  while(sum >> 16)
+    sum = (sum & 0xFFFF) + (sum >> 16);
+  return ~sum;
+}
+
+// heartbeat datagrams start with a decimal sequence number; any other
+// payload still counts as a heartbeat, just without loss accounting
+static bool parseSeq(const char* data, int len, uint32_t& seq)
+{
+  int i = 0;
+  seq = 0;
+  for(; i < len && data[i] >= '0' && data[i] <= '9'; i++)
+    seq = seq * 10 + (data[i] - '0');
+  return i > 0;
+}
+
+static void sleepMs(unsigned long ms)
+{
+#if defined(ARDUINO)
+  vTaskDelay(pdMS_TO_TICKS(ms));
+#else
+  usleep(ms * 1000);
+#endif
+}
+
+static void success(ProbeCallback callback, uint8_t target, uint8_t probe)
+{
+  Metrics::instance()->count(METRIC_PROBE_SUCCESSES);
+  if(callback)
+    callback(target, probe);
+}
+
+ProbeScheduler::ProbeScheduler () : m_callback(NULL), m_icmpSocket(-1)
+{
+  for(int t = 0; t < MAX_TARGETS; t++)
+  {
+    m_targets[t].probes = 0;
+    m_targets[t].udpSocket = -1;
+    m_targets[t].httpSocket = -1;
+  }
+}
+
+uint8_t ProbeScheduler::usable(const TargetConfig& cfg)
+{
+  uint8_t probes = cfg.probes & (PROBE_BIT(MAXPROBES) - 1);
+  if(!cfg.probeAddress)
+    probes &= ~(PROBE_BIT(PROBE_ICMP) | PROBE_BIT(PROBE_HTTP));
+  return probes ? probes : PROBE_BIT(PROBE_GPIO);
+}
+
+void ProbeScheduler::begin(ProbeCallback callback)
+{
+  m_callback = callback;
+}
+
+uint8_t ProbeScheduler::configure(uint8_t target, const TargetConfig& cfg)
+{
+  closeTarget(target);
+  ProbeTarget& p = m_targets[target];
+  uint8_t probes = usable(cfg) & ~PROBE_BIT(PROBE_GPIO);
+  p.address = cfg.probeAddress;
+  p.httpPort = cfg.httpPort;
+  strncpy(p.httpPath, cfg.httpPath.c_str(), sizeof(p.httpPath) - 1);
+  p.httpPath[sizeof(p.httpPath) - 1] = 0;
+  p.interval = cfg.probeInterval > 0 ? cfg.probeInterval : DEFAULT_PROBE_INTERVAL;
+  p.haveSeq = false;
+  p.udpSeq = 0;
+  p.icmpSeq = 0;
+  p.icmpPending = false;
+  p.icmpNext = 0;
+  p.httpNext = 0;
+
+  if(probes & PROBE_BIT(PROBE_UDP))
+  {
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(cfg.udpPort);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if(fd >= 0 && nonBlocking(fd) && bind(fd, (sockaddr*)&addr, sizeof(addr)) == 0)
+      p.udpSocket = fd;
+    else
+    {
+      if(fd >= 0)
+        close(fd);
+      probes &= ~PROBE_BIT(PROBE_UDP);
+      MemLogger::instance()->logEvent(LOGMSG_PS_FAILED, target, PROBE_UDP);
+    }
+  }
+  // raw sockets need root on a host, the bench skips ICMP without
+  if((probes & PROBE_BIT(PROBE_ICMP)) && m_icmpSocket < 0)
+  {
+    m_icmpSocket = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
+    if(m_icmpSocket >= 0 && !nonBlocking(m_icmpSocket))
+    {
+      close(m_icmpSocket);
+      m_icmpSocket = -1;
+    }
+  }
+  if((probes & PROBE_BIT(PROBE_ICMP)) && m_icmpSocket < 0)
+  {
+    probes &= ~PROBE_BIT(PROBE_ICMP);
+    MemLogger::instance()->logEvent(LOGMSG_PS_FAILED, target, PROBE_ICMP);
+  }
+  p.probes = probes;
+  if(probes)
+    MemLogger::instance()->logEvent(LOGMSG_PS_RUNNING, target, probes);
+  return probes;
+}
+
+void ProbeScheduler::closeTarget(uint8_t target)
+{
+  ProbeTarget& p = m_targets[target];
+  if(p.udpSocket >= 0)
+    close(p.udpSocket);
+  if(p.httpSocket >= 0)
+    close(p.httpSocket);
+  p.udpSocket = -1;
+  p.httpSocket = -1;
+  p.probes = 0;
+}
+
+void ProbeScheduler::stop()
+{
+  for(uint8_t t = 0; t < MAX_TARGETS; t++)
+    closeTarget(t);
+  if(m_icmpSocket >= 0)
+    close(m_icmpSocket);
+  m_icmpSocket = -1;
+}
+
+void ProbeScheduler::iterate(unsigned long now, unsigned long waitMs)
+{
+  fd_set readable, writable;
+  FD_ZERO(&readable);
+  FD_ZERO(&writable);
+  int maxFd = -1;
+  unsigned long wait = waitMs;
+
+  for(uint8_t t = 0; t < MAX_TARGETS; t++)
+  {
+    ProbeTarget& p = m_targets[t];
+    if(!p.probes)
+      continue;
+    if(p.probes & PROBE_BIT(PROBE_ICMP))
+    {
+      if((long)(now - p.icmpNext) >= 0)
+        sendIcmp(t, now);
+      if(p.icmpNext - now < wait)
+        wait = p.icmpNext - now;
+    }
+    if(p.probes & PROBE_BIT(PROBE_HTTP))
+    {
+      // an answer has until the next check is due
+      if(p.httpSocket >= 0 && (long)(now - p.httpStart) >= (long)p.interval)
+        endHttp(t, false);
+      if(p.httpSocket < 0 && (long)(now - p.httpNext) >= 0)
+        startHttp(t, now);
+      unsigned long due = p.httpSocket >= 0 ? p.httpStart + p.interval : p.httpNext;
+      if(due - now < wait)
+        wait = due - now;
+      if(p.httpSocket >= 0)
+      {
+        FD_SET(p.httpSocket, p.httpSent ? &readable : &writable);
+        maxFd = p.httpSocket > maxFd ? p.httpSocket : maxFd;
+      }
+    }
+    if(p.udpSocket >= 0)
+    {
+      FD_SET(p.udpSocket, &readable);
+      maxFd = p.udpSocket > maxFd ? p.udpSocket : maxFd;
+    }
+  }
+  if(m_icmpSocket >= 0)
+  {
+    FD_SET(m_icmpSocket, &readable);
+    maxFd = m_icmpSocket > maxFd ? m_icmpSocket : maxFd;
+  }
+
+  if(maxFd < 0)
+  {
+    sleepMs(wait);
+    return;
+  }
+  timeval timeout;
+  timeout.tv_sec = wait / 1000;
+  timeout.tv_usec = (wait % 1000) * 1000;
+  int ready = select(maxFd + 1, &readable, &writable, NULL, &timeout);
+  if(ready < 0)
+  {
+    // e.g. EBADF after a socket error; the task must still block
+    sleepMs(wait);
+    return;
+  }
+  if(!ready)
+    return;
+
+  if(m_icmpSocket >= 0 && FD_ISSET(m_icmpSocket, &readable))
+    receiveIcmp();
+  for(uint8_t t = 0; t < MAX_TARGETS; t++)
+  {
+    ProbeTarget& p = m_targets[t];
+    if(p.udpSocket >= 0 && FD_ISSET(p.udpSocket, &readable))
+      receiveUdp(t);
+    if(p.httpSocket >= 0)
+      serviceHttp(t, FD_ISSET(p.httpSocket, &writable), FD_ISSET(p.httpSocket, &readable));
+  }
+}
+
+void ProbeScheduler::receiveUdp(uint8_t target)
+{
+  ProbeTarget& p = m_targets[target];
+  for(int i = 0; i < PROBE_RECV_BURST; i++)
+  {
+    char data[32];
+    sockaddr_in from;
+    socklen_t fromLen = sizeof(from);
+    int n = recvfrom(p.udpSocket, data, sizeof(data), 0, (sockaddr*)&from, &fromLen);
+    if(n < 0)
+      return;
+    if(p.address && from.sin_addr.s_addr != p.address)
+      continue;
+    uint32_t seq;
+    if(parseSeq(data, n, seq))
+    {
+      // duplicates and late datagrams prove nothing new, a sequence far
+      // behind the last one is a sender that restarted
+      if(p.haveSeq && seq <= p.udpSeq && p.udpSeq - seq < PROBE_UDP_REORDER)
+        continue;
+      if(p.haveSeq && seq > p.udpSeq + 1)
+        Metrics::instance()->add(METRIC_UDP_HEARTBEATS_LOST, seq - p.udpSeq - 1);
+      p.udpSeq = seq;
+      p.haveSeq = true;
+    }
+    success(m_callback, target, PROBE_UDP);
+  }
+}
+
+void ProbeScheduler::sendIcmp(uint8_t target, unsigned long now)
+{
+  ProbeTarget& p = m_targets[target];
+  if(p.icmpPending)
+    Metrics::instance()->count(METRIC_PROBE_FAILURES);
+  p.icmpNext = now + p.interval;
+
+  IcmpEcho echo = {};
+  echo.type = PROBE_ICMP_ECHO;
+  echo.id = htons(PROBE_ICMP_ID | target);
+  echo.seq = htons(++p.icmpSeq);
+  echo.checksum = htons(checksum((const uint8_t*)&echo, sizeof(echo)));
+  sockaddr_in to = {};
+  to.sin_family = AF_INET;
+  to.sin_addr.s_addr = p.address;
+  // a failed send is counted with the next one, like a lost reply
+  sendto(m_icmpSocket, &echo, sizeof(echo), 0, (sockaddr*)&to, sizeof(to));
+  p.icmpPending = true;
+}
+
+void ProbeScheduler::receiveIcmp()
+{
+  for(int i = 0; i < PROBE_RECV_BURST; i++)
+  {
+    uint8_t data[128];
+    sockaddr_in from;
+    socklen_t fromLen = sizeof(from);
+    int n = recvfrom(m_icmpSocket, data, sizeof(data), 0, (sockaddr*)&from, &fromLen);
+    if(n < 0)
+      return;
+    // raw sockets deliver the IP header as well
+    size_t header = (data[0] & 0x0F) * 4;
+    if((size_t)n < header + sizeof(IcmpEcho))
+      continue;
+    IcmpEcho echo;
+    memcpy(&echo, data + header, sizeof(echo));
+    uint16_t id = ntohs(echo.id);
+    uint8_t t = id & 0xFF;
+    if(echo.type != PROBE_ICMP_ECHO_REPLY || (id & 0xFF00) != PROBE_ICMP_ID || t >= MAX_TARGETS)
+      continue;
+    ProbeTarget& p = m_targets[t];
+    if(!(p.probes & PROBE_BIT(PROBE_ICMP)) || !p.icmpPending || ntohs(echo.seq) != p.icmpSeq || from.sin_addr.s_addr != p.address)
+      continue;
+    p.icmpPending = false;
+    success(m_callback, t, PROBE_ICMP);
+  }
+}
+
+void ProbeScheduler::startHttp(uint8_t target, unsigned long now)
+{
+  ProbeTarget& p = m_targets[target];
+  p.httpStart = now;
+  p.httpNext = now + p.interval;
+  p.httpSent = false;
+  p.httpLen = 0;
+
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(p.httpPort);
+  addr.sin_addr.s_addr = p.address;
+  int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if(fd < 0 || !nonBlocking(fd) || (connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0 && errno != EINPROGRESS))
+  {
+    if(fd >= 0)
+      close(fd);
+    Metrics::instance()->count(METRIC_PROBE_FAILURES);
+    return;
+  }
+  p.httpSocket = fd;
+}
+
+// connect, send the request once the socket is writable, then read the
+// status line; the rest of the answer is not waited for
+void ProbeScheduler::serviceHttp(uint8_t target, bool writable, bool readable)
+{
+  ProbeTarget& p = m_targets[target];
+  if(!p.httpSent)
+  {
+    if(!writable)
+      return;
+    int error = 0;
+    socklen_t len = sizeof(error);
+    if(getsockopt(p.httpSocket, SOL_SOCKET, SO_ERROR, &error, &len) != 0 || error)
+    {
+      endHttp(target, false);
+      return;
+    }
+    const uint8_t* ip = (const uint8_t*)&p.address;
+    char request[CONFIG_PATH_SIZE + 96];
+    int n = snprintf(request, sizeof(request), "GET %s HTTP/1.0\r\nHost: %u.%u.%u.%u\r\nConnection: close\r\n\r\n",
+      p.httpPath, ip[0], ip[1], ip[2], ip[3]);
+    // a fresh connection takes a request this small in one go
+    if(send(p.httpSocket, request, n, 0) != n)
+    {
+      endHttp(target, false);
+      return;
+    }
+    p.httpSent = true;
+    return;
+  }
+  if(!readable)
+    return;
+  int n = recv(p.httpSocket, p.httpStatus + p.httpLen, sizeof(p.httpStatus) - 1 - p.httpLen, 0);
+  if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    return;
+  if(n <= 0)
+  {
+    endHttp(target, false);
+    return;
+  }
+  p.httpLen += n;
+  // "HTTP/1.1 200"
+  if(p.httpLen < 12)
+    return;
+  endHttp(target, strncmp(p.httpStatus, "HTTP/1.", 7) == 0 && p.httpStatus[9] == '2');
+}
+
+void ProbeScheduler::endHttp(uint8_t target, bool ok)
+{
+  ProbeTarget& p = m_targets[target];
+  close(p.httpSocket);
+  p.httpSocket = -1;
+  if(ok)
+    success(m_callback, target, PROBE_HTTP);
+  else
+    Metrics::instance()->count(METRIC_PROBE_FAILURES);
+}
+
+#if defined(ARDUINO)
+void ProbeScheduler::task(void* arg)
+{
+  ProbeScheduler* scheduler = reinterpret_cast<ProbeScheduler*>(arg);
+  while(true)
+    scheduler->iterate(millis(), PROBE_TASK_WAIT);
+}
+#endif
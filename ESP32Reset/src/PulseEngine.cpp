@@ -0,0 +1,112 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <Arduino.h>
+
+#include <PulseEngine.h>
+#include <Hal.h>
+
+bool PulseEngine::queue(const PulseStep* steps, uint8_t count, PulseCallback done, void* arg)
+{
+  if(!count)
+    return false;
+  uint16_t head = m_head.load(std::memory_order_relaxed);
+  if((uint16_t)(head - m_tail.load(std::memory_order_acquire)) + count > PULSE_MAX_STEPS)
+    return false;
+  if(m_queued - m_notified >= PULSE_MAX_WAVEFORMS)
+    return false;
+
+  for(uint8_t i = 0; i < count; i++)
+  {
+    PulseStep& step = m_steps[(uint16_t)(head + i) & (PULSE_MAX_STEPS - 1)];
+    step = steps[i];
+    step.last = i == count - 1;
+  }
+  Waveform& waveform = m_waveforms[m_queued & (PULSE_MAX_WAVEFORMS - 1)];
+  waveform.callback = done;
+  waveform.arg = arg;
+  m_queued++;
+
+  m_head.store(head + count, std::memory_order_release);
+  kick();
+  return true;
+}
+
+void PulseEngine::iterate()
+{
+  // report finished waveforms in the order they were queued
+  uint32_t completed = m_completed.load(std::memory_order_acquire);
+  while(m_notified != completed)
+  {
+    Waveform& waveform = m_waveforms[m_notified & (PULSE_MAX_WAVEFORMS - 1)];
+    m_notified++;
+    if(waveform.callback)
+      waveform.callback(waveform.arg);
+  }
+}
+
+// starts playing if there are steps and nobody owns the timer yet; both the
+// loop task and the timer callback may race here, only one wins the flag
+void PulseEngine::kick()
+{
+  uint32_t idle = 0;
+  if(m_tail.load(std::memory_order_relaxed) != m_head.load(std::memory_order_acquire)
+    && m_running.compare_exchange_strong(idle, 1))
+    startStep();
+}
+
+void PulseEngine::startStep()
+{
+  const PulseStep& step = m_steps[m_tail.load(std::memory_order_relaxed) & (PULSE_MAX_STEPS - 1)];
+  Hal::instance()->digitalWrite(step.pin, step.level);
+  Hal::instance()->armTimer(HAL_TIMER_PULSE, step.holdUs, onTimer);
+}
+
+void PulseEngine::onTimer()
+{
+  PulseEngine* engine = instance();
+  uint16_t tail = engine->m_tail.load(std::memory_order_relaxed);
+  if(engine->m_steps[tail & (PULSE_MAX_STEPS - 1)].last)
+  {
+    engine->m_completed.fetch_add(1, std::memory_order_release);
+    // the completion callback runs in iterate()
+    Hal::wakeWatchdog();
+  }
+  engine->m_tail.store(++tail, std::memory_order_release);
+
+  if(tail != engine->m_head.load(std::memory_order_acquire))
+  {
+    engine->startStep();
+    return;
+  }
+  // release the timer, then catch a waveform queued in the meantime
+  engine->m_running.store(0);
+  engine->kick();
+}
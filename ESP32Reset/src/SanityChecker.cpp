@@ -31,155 +31,463 @@
 #include <Arduino.h>
 
 #include <SanityChecker.h>
+#include <Hal.h>
+#include <PulseEngine.h>
 #include <MemLogger.h>
+#include <Metrics.h>
 #include <Constants.h>
 #include <ConfigManager.h>
+#include <ProbeScheduler.h>
 
-bool SanityChecker::init(unsigned long nowTime, uint32_t interval)
+
+SpscRing<PinEdge, SC_EDGE_RING_SIZE> SanityChecker::s_edges;
+volatile bool SanityChecker::s_deadlineExpired = false;
+SpscRing<WatchdogCommand, SC_COMMAND_RING_SIZE> SanityChecker::s_commands;
+SpscRing<ProbeResult, SC_PROBE_RING_SIZE> SanityChecker::s_probeResults;
+
+// the stats are written by the watchdog task and copied by the web server
+// task on the other core, this keeps the copies from being torn
+#if defined(ARDUINO)
+static portMUX_TYPE s_statsMux = portMUX_INITIALIZER_UNLOCKED;
+#define STATS_LOCK()    portENTER_CRITICAL(&s_statsMux)
+#define STATS_UNLOCK()  portEXIT_CRITICAL(&s_statsMux)
+#else
+#define STATS_LOCK()
+#define STATS_UNLOCK()
+#endif
+
+// shared by all heartbeat and power watch pins, arg is the pin
+void IRAM_ATTR SanityChecker::onPinEdge(void* arg)
 {
-  BoardConfig* boardcfg = reinterpret_cast<BoardConfig*>(ConfigManager::instance()->getConfig(CONFIG_TYPE::BOARD));
+  PinEdge edge;
+  edge.micros = Hal::isrMicros();
+  edge.pin = (uint8_t)(uintptr_t)arg;
+  s_edges.push(edge);
+  Hal::wakeWatchdog();
+}
 
-  m_heartBeatCountTrigger = boardcfg->heartBeatCnt;
-  m_coolDownTimeTrigger = boardcfg->cooldownTime;
-  m_lockupTimeTrigger = boardcfg->lockupTime;
+void SanityChecker::probeOk(uint8_t target, uint8_t probe)
+{
+  ProbeResult result;
+  result.target = target;
+  result.probe = probe;
+  result.started = 0;
+  s_probeResults.push(result);
+  Hal::wakeWatchdog();
+}
 
-  m_coolDownEnd = boardcfg->cooldownTime;
+void SanityChecker::probesStarted(uint8_t target, uint8_t probes)
+{
+  ProbeResult result;
+  result.target = target;
+  result.probe = MAXPROBES;
+  result.started = probes;
+  s_probeResults.push(result);
+  Hal::wakeWatchdog();
+}
 
-  m_resetApplied = false;
-  m_lastTimeHeartBeatChanged = 0;
+void SanityChecker::onDeadline()
+{
+  s_deadlineExpired = true;
+  Hal::wakeWatchdog();
+}
+
+void SanityChecker::onRecoveryDone(void* arg)
+{
+  SanityChecker* checker = instance();
+  uint8_t target = (uint8_t)(uintptr_t)arg;
+  MemLogger::logDeferred(LOGMSG_SC_COMBI_DONE, target);
+  checker->m_recovering &= ~(1 << target);
+  // look at whatever happened to the pins meanwhile
+  s_deadlineExpired = true;
+}
+
+bool SanityChecker::validPins(uint8_t target) const
+{
+  // power watch is optional, so is the heartbeat pin if other probes
+  // judge liveness; everything else has to be a distinct GPIO
+  uint8_t pins[4] = { m_heartBeatPin[target], m_resetPin[target], m_powerPin[target], m_powerWatchPin[target] };
+  bool heartBeat = m_probes[target] & PROBE_BIT(PROBE_GPIO);
+  for(int i = 0; i < 4; i++)
+  {
+    if(pins[i] == PIN_UNUSED && (i == 3 || (i == 0 && !heartBeat)))
+      continue;
+    if(pins[i] >= SC_MAX_PINS)
+      return false;
+    for(int j = 0; j < i; j++)
+      if(pins[i] == pins[j])
+        return false;
+    // not taken by one of the targets before
+    for(uint8_t t = 0; t < target; t++)
+      if(pins[i] == m_heartBeatPin[t] || pins[i] == m_resetPin[t] || pins[i] == m_powerPin[t] || pins[i] == m_powerWatchPin[t])
+        return false;
+  }
+  return true;
+}
+
+bool SanityChecker::init(unsigned long nowTime)
+{
+  BoardConfig* boardcfg = reinterpret_cast<BoardConfig*>(ConfigManager::instance()->getConfig(CONFIG_TYPE::BOARD));
+
+  m_targetCount = boardcfg->targetCount < MAX_TARGETS ? boardcfg->targetCount : MAX_TARGETS;
+  m_supervised = 0;
+  m_enabled = 0;
+  m_recovering = 0;
+  m_haveLastEdge = 0;
   m_lastTimeLoopIteration = 0;
-  m_lastHeartBeatValue = 0;
-  m_heartBeatCounter = 0;
+  STATS_LOCK();
+  m_edgeLatency.reset();
+  STATS_UNLOCK();
+  m_resetStats = false;
+  memset(m_pinTarget, SC_NO_TARGET, sizeof(m_pinTarget));
+
+  MemLogger::logDeferred(LOGMSG_SC_INIT, m_targetCount);
+
+  // drop edges left over from a previous run
+  PinEdge edge;
+  while(s_edges.pop(edge));
+  ProbeResult result;
+  while(s_probeResults.pop(result));
+
+  for(uint8_t t = 0; t < m_targetCount; t++)
+  {
+    const TargetConfig& cfg = boardcfg->targets[t];
+    m_heartBeatPin[t] = cfg.heartBeatPin;
+    m_powerWatchPin[t] = cfg.powerWatchPin;
+    m_resetPin[t] = cfg.resetPin;
+    m_powerPin[t] = cfg.powerPin;
+    m_heartBeatCountTrigger[t] = cfg.heartBeatCnt;
+    m_coolDownTimeTrigger[t] = cfg.cooldownTime;
+    m_lockupTimeTrigger[t] = cfg.lockupTime;
+    m_quorumSetting[t] = cfg.quorum;
+    setProbes(t, ProbeScheduler::usable(cfg));
+    m_probeTimeout[t][PROBE_GPIO] = cfg.lockupTime;
+    m_probeTimeout[t][PROBE_UDP] = cfg.udpTimeout;
+    m_probeTimeout[t][PROBE_ICMP] = cfg.icmpTimeout;
+    m_probeTimeout[t][PROBE_HTTP] = cfg.httpTimeout;
+    memset(m_lastProbeOk[t], 0, sizeof(m_lastProbeOk[t]));
+    m_probesSeen[t] = 0;
 
-  m_enabled = boardcfg->enabled;
+    m_coolDownEnd[t] = cfg.cooldownTime;
+    m_lastTimeHeartBeatChanged[t] = 0;
+    m_lastHeartBeatValue[t] = 0;
+    m_lastPowerValue[t] = 1;
+    m_heartBeatCounter[t] = 0;
+    m_lockups[t] = 0;
+    STATS_LOCK();
+    m_heartBeatStats[t].reset();
+    STATS_UNLOCK();
 
-  MemLogger::instance()->logMessage("=SC: Initializing Sanity Checker...\n");
-  // define input heartbeat pin...
-  pinMode(HEARTBEAT, INPUT);
-  pinMode(POWERWATCH, INPUT);
+    if(!validPins(t))
+    {
+      MemLogger::logDeferred(LOGMSG_SC_BAD_TARGET, t);
+      continue;
+    }
+    m_supervised |= 1 << t;
+    if(cfg.enabled)
+      m_enabled |= 1 << t;
 
-  // define pulldowns to be down by default
-  pinMode(ROCKRESET, OUTPUT);
-  pinMode(ROCKPOWER, OUTPUT);
-  digitalWrite(ROCKRESET, LOW);
-  digitalWrite(ROCKPOWER, LOW);
+    // define pulldowns to be down by default
+    Hal::instance()->pinMode(m_resetPin[t], OUTPUT);
+    Hal::instance()->pinMode(m_powerPin[t], OUTPUT);
+    Hal::instance()->digitalWrite(m_resetPin[t], LOW);
+    Hal::instance()->digitalWrite(m_powerPin[t], LOW);
+
+    // timestamp every change of heartbeat and power from now on
+    if(m_probes[t] & PROBE_BIT(PROBE_GPIO))
+    {
+      Hal::instance()->pinMode(m_heartBeatPin[t], INPUT);
+      m_pinTarget[m_heartBeatPin[t]] = t;
+      Hal::instance()->attachInterrupt(m_heartBeatPin[t], onPinEdge, (void*)(uintptr_t)m_heartBeatPin[t], CHANGE);
+    }
+    if(m_powerWatchPin[t] != PIN_UNUSED)
+    {
+      Hal::instance()->pinMode(m_powerWatchPin[t], INPUT);
+      m_pinTarget[m_powerWatchPin[t]] = t;
+      Hal::instance()->attachInterrupt(m_powerWatchPin[t], onPinEdge, (void*)(uintptr_t)m_powerWatchPin[t], CHANGE);
+    }
+  }
 
-  m_pollingInterval = interval;
-  m_nextPoll = nowTime + interval;
+  // evaluate the initial pin levels on the first iteration
+  samplePins();
+  m_nextDeadline = nowTime;
+  s_deadlineExpired = true;
+  m_armedMicros = Hal::instance()->micros();
   return true;
 }
 
-void SanityChecker::convertMillis(unsigned long milli, unsigned long& hour, unsigned long &minute, unsigned long &second, unsigned long &remainder)
+bool SanityChecker::post(WD_CMD cmd, uint8_t target, uint32_t arg)
 {
-  //3600000 milliseconds in an hour
-  hour = milli / 3600000;
-  milli = milli - 3600000 * hour;
-  //60000 milliseconds in a minute
-  minute = milli / 60000;
-  milli = milli - 60000 * minute;
+  if(target >= m_targetCount)
+    return false;
+  WatchdogCommand command;
+  command.cmd = cmd;
+  command.target = target;
+  command.arg = arg;
+  bool queued = s_commands.push(command);
+  Hal::wakeWatchdog();
+  return queued;
+}
 
-  //1000 milliseconds in a second
-  second = milli / 1000;
-  remainder = milli - 1000 * second;
+void SanityChecker::consumeCommands()
+{
+  WatchdogCommand command;
+  while(s_commands.pop(command))
+  {
+    uint8_t t = command.target;
+    if(!supervised(t))
+      continue;
+    switch(command.cmd)
+    {
+      case WD_CMD_ENABLE:
+        m_enabled |= 1 << t;
+        MemLogger::logDeferred(LOGMSG_SC_ENABLE, t);
+        break;
+      case WD_CMD_DISABLE:
+        m_enabled &= ~(1 << t);
+        MemLogger::logDeferred(LOGMSG_SC_DISABLE, t);
+        break;
+      case WD_CMD_RESET:
+        sendReset(t, command.arg);
+        break;
+      case WD_CMD_POWER:
+        sendPower(t, command.arg);
+        break;
+      default:
+        break;
+    }
+  }
 }
 
-void SanityChecker::setState(bool enabled)
+WD_STATE SanityChecker::state(uint8_t target, unsigned long currentTime) const
 {
-    MemLogger::instance()->logMessage(enabled ? "=SC: Enable WD\n" : "=SC: Disable WD\n");
-    m_enabled = enabled;
-    ConfigManager::instance()->setState(enabled);
+  if(recovering(target))
+    return WD_RECOVERING;
+  if(!supervised(target) || !(m_enabled & (1 << target)))
+    return WD_DISABLED;
+  return currentTime < m_coolDownEnd[target] ? WD_COOLDOWN : WD_WATCHING;
 }
 
-bool SanityChecker::coolDownActive(unsigned long currentTime, unsigned long hour, unsigned long minute, unsigned long second, unsigned long remainder)
+bool SanityChecker::coolDownActive(uint8_t target, unsigned long currentTime)
 {
-  bool active = currentTime < m_coolDownEnd;
+  bool active = currentTime < m_coolDownEnd[target];
   if(active)
   {
-    unsigned long seconds2 = (m_coolDownEnd - currentTime) / 1000;
-
-    char buf[256];
-    sprintf(buf,"=SC:[%02lu:%02lu:%02lu.%03lu] Cooldown active for another %lu seconds\n", hour, minute, second, remainder, seconds2);
-    MemLogger::instance()->logMessage(buf);
+    MemLogger::logDeferred(LOGMSG_SC_COOLDOWN, target, (m_coolDownEnd[target] - currentTime) / 1000);
   }
   return active;
 }
 
-bool SanityChecker::readHeartBeat(unsigned long currentTime, unsigned long hour, unsigned long minute, unsigned long second, unsigned long remainder)
+void SanityChecker::consumeEdges(unsigned long currentTime)
 {
-  m_lastPowerValue = digitalRead(POWERWATCH);
-#if PRINT_VERBOSE
-  char buf[256];
-  sprintf(buf,"=SC:[%02lu:%02lu:%02lu.%03lu] Current Power Watch Status: %s\n", hour, minute, second, remainder, m_lastPowerValue ? "on" : "off");
-  MemLogger::instance()->logMessage(buf);
-#endif
-  int currentHeartBeatValue = digitalRead(HEARTBEAT);
-  // value changed!
-  if(currentHeartBeatValue != m_lastHeartBeatValue)
-  {
-    m_lastHeartBeatValue = currentHeartBeatValue;
-    m_lastTimeHeartBeatChanged = currentTime;
-    if(m_heartBeatCounter < m_heartBeatCountTrigger) {
-      m_heartBeatCounter++;
+  if(m_resetStats)
+  {
+    STATS_LOCK();
+    for(uint8_t t = 0; t < m_targetCount; t++)
+      m_heartBeatStats[t].reset();
+    m_edgeLatency.reset();
+    STATS_UNLOCK();
+    m_resetStats = false;
+  }
+
+  uint32_t nowMicros = Hal::instance()->micros();
+  PinEdge edge;
+  while(s_edges.pop(edge))
+  {
+    // power is sampled below, its edge only has to wake us up
+    uint8_t t = edge.pin < SC_MAX_PINS ? m_pinTarget[edge.pin] : SC_NO_TARGET;
+    if(t == SC_NO_TARGET || edge.pin != m_heartBeatPin[t])
+      continue;
+    uint8_t bit = 1 << t;
+    Metrics::instance()->count(METRIC_HEARTBEAT_EDGES);
+    int32_t latency = (int32_t)(nowMicros - edge.micros);
+    STATS_LOCK();
+    m_edgeLatency.add(latency > 0 ? latency : 0);
+    // only steady-state intervals, not the ones spanning a recovery or boot
+    if((m_haveLastEdge & bit) && m_heartBeatCounter[t] > m_heartBeatCountTrigger[t])
+      m_heartBeatStats[t].add(edge.micros - m_lastEdgeMicros[t]);
+    STATS_UNLOCK();
+    m_lastEdgeMicros[t] = edge.micros;
+    m_haveLastEdge |= bit;
+
+    // edges pushed after nowMicros was taken count as now
+    int32_t age = latency / 1000;
+    unsigned long edgeTime = (age > 0 && (unsigned long)age < currentTime) ? currentTime - age : currentTime;
+    if(edgeTime < m_lastTimeHeartBeatChanged[t])
+      edgeTime = m_lastTimeHeartBeatChanged[t];
+
+    m_lastTimeHeartBeatChanged[t] = edgeTime;
+    if(m_heartBeatCounter[t] < m_heartBeatCountTrigger[t]) {
+      m_heartBeatCounter[t]++;
     }
-    else if(m_heartBeatCounter == m_heartBeatCountTrigger) {
-      char buf[256];
-      sprintf(buf,"=SC: [%02lu:%02lu:%02lu.%03lu] Resetting cooldown timer!\n", hour, minute, second, remainder);
-      MemLogger::instance()->logMessage(buf);
-      m_coolDownEnd = currentTime;
-      m_heartBeatCounter++;
+    else if(m_heartBeatCounter[t] == m_heartBeatCountTrigger[t]) {
+      MemLogger::logDeferred(LOGMSG_SC_RESET_COOLDOWN, t);
+      m_coolDownEnd[t] = edgeTime;
+      m_heartBeatCounter[t]++;
     }
-    return false;
   }
-  else // value did not change
+  samplePins();
+}
+
+void SanityChecker::consumeProbes(unsigned long currentTime)
+{
+  ProbeResult result;
+  while(s_probeResults.pop(result))
   {
-    // locked up!
-    if(((currentTime > (m_lastTimeHeartBeatChanged + m_lockupTimeTrigger)) && !coolDownActive(currentTime, hour, minute, second, remainder)) || !m_lastPowerValue)
+    uint8_t t = result.target;
+    if(t >= m_targetCount || result.probe > MAXPROBES)
+      continue;
+    if(result.probe == MAXPROBES)
+    {
+      // a probe whose socket could not be opened would never be up
+      setProbes(t, m_probes[t] & (result.started | PROBE_BIT(PROBE_GPIO)));
+      continue;
+    }
+    m_lastProbeOk[t][result.probe] = currentTime;
+    m_probesSeen[t] |= PROBE_BIT(result.probe);
+    // without the heartbeat pin there are no edges to count, the cooldown
+    // ends once the quorum of probes has answered
+    if(!(m_probes[t] & PROBE_BIT(PROBE_GPIO)) && m_coolDownEnd[t] > currentTime &&
+       __builtin_popcount(m_probesSeen[t] & m_probes[t]) >= m_quorum[t])
     {
-      delay(500);
-      m_heartBeatCounter = 0;
-      return true;
+      MemLogger::logDeferred(LOGMSG_SC_RESET_COOLDOWN, t);
+      m_coolDownEnd[t] = currentTime;
     }
   }
-  return false;
 }
 
-// sends a reset signal to the RockPro64
-void SanityChecker::sendReset(unsigned long timePullDown)
+void SanityChecker::setProbes(uint8_t target, uint8_t probes)
+{
+  uint8_t count = __builtin_popcount(probes);
+  m_probes[target] = probes;
+  m_quorum[target] = m_quorumSetting[target] == 0 || m_quorumSetting[target] > count ? count : m_quorumSetting[target];
+}
+
+void SanityChecker::samplePins()
 {
-  unsigned long currentTime = millis();
-  unsigned long doneTime = currentTime+timePullDown;
-  MemLogger::instance()->logMessage("=SC: Executing RESET message\n");
-  digitalWrite(ROCKRESET, HIGH);
-  while(doneTime > currentTime)
+  for(uint8_t t = 0; t < m_targetCount; t++)
   {
-    delay(50);
-    yield();
-    currentTime = millis();
+    if(!supervised(t))
+      continue;
+    // without power watch the board counts as powered
+    m_lastPowerValue[t] = m_powerWatchPin[t] == PIN_UNUSED ? 1 : Hal::instance()->digitalRead(m_powerWatchPin[t]);
+    if(m_probes[t] & PROBE_BIT(PROBE_GPIO))
+      m_lastHeartBeatValue[t] = Hal::instance()->digitalRead(m_heartBeatPin[t]);
+#if PRINT_VERBOSE
+    MemLogger::logDeferred(m_lastPowerValue[t] ? LOGMSG_SC_POWER_WATCH_ON : LOGMSG_SC_POWER_WATCH_OFF, t);
+#endif
   }
-  digitalWrite(ROCKRESET, LOW);
-  delay(200);
 }
 
-void SanityChecker::sendPower(unsigned long timePullDown, bool ignorePowerStatus)
+// last moment the probe counts as up
+unsigned long SanityChecker::probeExpiry(uint8_t target, uint8_t probe) const
 {
-  unsigned long currentTime = millis();
-  unsigned long doneTime = currentTime+timePullDown;
-  if(ignorePowerStatus)
+  if(probe == PROBE_GPIO)
+    return m_lastTimeHeartBeatChanged[target] + m_lockupTimeTrigger[target];
+  return m_lastProbeOk[target][probe] + m_probeTimeout[target][probe];
+}
+
+uint8_t SanityChecker::probesUp(uint8_t target, unsigned long currentTime) const
+{
+  uint8_t up = 0;
+  for(uint8_t p = 0; p < MAXPROBES; p++)
+    if((m_probes[target] & PROBE_BIT(p)) && currentTime <= probeExpiry(target, p))
+      up++;
+  return up;
+}
+
+void SanityChecker::heartBeatStats(uint8_t target, IntervalStats& out) const
+{
+  STATS_LOCK();
+  out = m_heartBeatStats[target];
+  STATS_UNLOCK();
+}
+
+void SanityChecker::edgeLatencyStats(IntervalStats& out) const
+{
+  STATS_LOCK();
+  out = m_edgeLatency;
+  STATS_UNLOCK();
+}
+
+bool SanityChecker::lockedUp(uint8_t target, unsigned long currentTime)
+{
+  if((probesUp(target, currentTime) < m_quorum[target] && !coolDownActive(target, currentTime)) || !m_lastPowerValue[target])
+  {
+    m_heartBeatCounter[target] = 0;
+    return true;
+  }
+  return false;
+}
+
+void SanityChecker::armDeadline(unsigned long currentTime)
+{
+  // the lockup condition of a target can only become true once one of its
+  // probes that are up times out, or the cooldown is over if that was the
+  // reason it did not trigger; the earliest one wins. Probe results wake
+  // the task by themselves
+  unsigned long earliest = (unsigned long)-1;
+  for(uint8_t t = 0; t < m_targetCount; t++)
   {
-    MemLogger::instance()->logMessage("=SC: Executing POWER message\n");
-    digitalWrite(ROCKPOWER, HIGH);
-    while(doneTime > currentTime)
+    if(!supervised(t) || recovering(t))
+      continue;
+    unsigned long deadline = (unsigned long)-1;
+    if(probesUp(t, currentTime) >= m_quorum[t])
     {
-      delay(50);
-      yield();
-      currentTime = millis();
+      for(uint8_t p = 0; p < MAXPROBES; p++)
+        if((m_probes[t] & PROBE_BIT(p)) && currentTime <= probeExpiry(t, p) && probeExpiry(t, p) + 1 < deadline)
+          deadline = probeExpiry(t, p) + 1;
     }
-    digitalWrite(ROCKPOWER, LOW);
-    delay(200);
+    else
+      deadline = m_coolDownEnd[t] > currentTime ? m_coolDownEnd[t] : currentTime + 1;
+    if(deadline < earliest)
+      earliest = deadline;
+  }
+  // recovering targets are looked at again when their pulses are done
+  if(earliest == (unsigned long)-1)
+    return;
+  m_nextDeadline = earliest;
+
+  unsigned long now = Hal::instance()->millis();
+  Hal::instance()->armTimer(HAL_TIMER_DEADLINE, earliest > now ? (uint64_t)(earliest - now) * 1000 : 0, onDeadline);
+}
+
+// sends a reset signal to the target, returns immediately and leaves
+// holding the line to the PulseEngine
+bool SanityChecker::sendReset(uint8_t target, unsigned long timePullDown)
+{
+  if(!supervised(target))
+    return false;
+  MemLogger::logDeferred(LOGMSG_SC_RESET, target, timePullDown);
+  PulseStep steps[] = {
+    { m_resetPin[target], HIGH, false, (uint32_t)(timePullDown * 1000) },
+    { m_resetPin[target], LOW, false, 200000 }
+  };
+  if(!PulseEngine::instance()->queue(steps, 2))
+    return false;
+  Metrics::instance()->count(METRIC_RESET_PULSES);
+  return true;
+}
+
+bool SanityChecker::sendPower(uint8_t target, unsigned long timePullDown, bool ignorePowerStatus)
+{
+  if(!supervised(target))
+    return false;
+  if(ignorePowerStatus)
+  {
+    MemLogger::logDeferred(LOGMSG_SC_POWER, target, timePullDown);
+    PulseStep steps[] = {
+      { m_powerPin[target], HIGH, false, (uint32_t)(timePullDown * 1000) },
+      { m_powerPin[target], LOW, false, 200000 }
+    };
+    if(!PulseEngine::instance()->queue(steps, 2))
+      return false;
+    Metrics::instance()->count(METRIC_POWER_PULSES);
+    return true;
   }
   else
   {
-    MemLogger::instance()->logMessage("=SC: Ignoring POWER message\n");
+    MemLogger::logDeferred(LOGMSG_SC_IGNORE_POWER, target);
     // CHECK CURRENT POWER STATUS AND DECIDE ON PULLDOWN TIMEOUT
     // work with m_lastPowerValue
 
@@ -188,68 +496,95 @@ void SanityChecker::sendPower(unsigned long timePullDown, bool ignorePowerStatus
 
 
   }
+  return false;
+}
+
+void SanityChecker::recover(uint8_t target, unsigned long currentTime)
+{
+  uint8_t bit = 1 << target;
+  Metrics::instance()->count(METRIC_LOCKUPS);
+  m_lockups[target]++;
+  if(m_enabled & bit)
+  {
+    MemLogger::logDeferred(LOGMSG_SC_LOCKED_UP, target, probesUp(target, currentTime));
+    MemLogger::logDeferred(m_lastHeartBeatValue[target] > 0 ? LOGMSG_SC_STATUS_ON : LOGMSG_SC_STATUS_OFF, target);
+    MemLogger::logDeferred(LOGMSG_SC_SEND_COMBI, target);
+
+    // settle, power pulse, gap, reset pulse; played by the PulseEngine
+    // while the other targets keep being watched. Recoveries of several
+    // targets are played one after the other
+    PulseStep steps[] = {
+      { m_powerPin[target], LOW, false, 500000 },
+      { m_powerPin[target], HIGH, false, 2000000 },
+      { m_powerPin[target], LOW, false, 1200000 },
+      { m_resetPin[target], HIGH, false, 2000000 },
+      { m_resetPin[target], LOW, false, 200000 }
+    };
+    if(PulseEngine::instance()->queue(steps, 5, onRecoveryDone, (void*)(uintptr_t)target))
+    {
+      m_recovering |= bit;
+      Metrics::instance()->count(METRIC_POWER_PULSES);
+      Metrics::instance()->count(METRIC_RESET_PULSES);
+    }
+    else
+      MemLogger::logDeferred(LOGMSG_SC_QUEUE_FULL, target);
+  }
+  m_haveLastEdge &= ~bit;
+  // sets back the timer for eval against RESET_TIME secs
+  m_lastTimeHeartBeatChanged[target] = currentTime;
+  for(uint8_t p = 0; p < MAXPROBES; p++)
+    m_lastProbeOk[target][p] = currentTime;
+  m_probesSeen[target] = 0;
+  // cooldown should start now!
+  m_coolDownEnd[target] = currentTime + m_coolDownTimeTrigger[target];
+  Metrics::instance()->count(METRIC_COOLDOWNS);
 }
 
 void SanityChecker::iterate(unsigned long currentTime)
 {
-  if(currentTime <= m_nextPoll)
+  // commands from the web server, pulses may be queued during a recovery
+  if(!s_commands.empty())
+    consumeCommands();
+
+  // neither a pin edge, a probe result nor the deadline timer fired,
+  // nothing to evaluate
+  if(s_edges.empty() && s_probeResults.empty() && !s_deadlineExpired)
   {
-    yield();
+    Hal::instance()->yield();
     return;
   }
-  m_nextPoll += m_pollingInterval;
+  s_deadlineExpired = false;
 
   // safeguard overflow after 50 days or so...
   if(m_lastTimeLoopIteration > currentTime)
   {
     m_lastTimeLoopIteration = currentTime;
-    m_coolDownEnd = currentTime;
+    for(uint8_t t = 0; t < m_targetCount; t++)
+      m_coolDownEnd[t] = currentTime;
     return;
   }
 
-  unsigned long hour, minute, second, remainder;
-  convertMillis(currentTime, hour, minute, second, remainder);
-
   // m_lastHeartBeatValue is the heartbeat
   // it is 0 (and does not change if board is off)
   // it is 1 (and does not change if board is on and locked up)
   // it alternates between 0 and 1 otherwise
 
-  // returns true if board is off or locked up
-  if(readHeartBeat(currentTime, hour, minute, second, remainder))
-  {
-    if(m_enabled)
-    {
-      char buf[256];
-      sprintf(buf,"=SC:[%02lu:%02lu:%02lu.%03lu] Board locked up!\n", hour, minute, second, remainder);
-      MemLogger::instance()->logMessage(buf);
-
-      sprintf(buf,"=SC:[%02lu:%02lu:%02lu.%03lu] Status is %s!\n", hour,
-        minute, second, remainder, m_lastHeartBeatValue > 0 ? "on" : "off");
-      MemLogger::instance()->logMessage(buf);
-
-      sprintf(buf,"=SC:[%02lu:%02lu:%02lu.%03lu] Send power/reset combi!\n", hour, minute, second, remainder);
-      MemLogger::instance()->logMessage(buf);
-
-      sendPower(2000);
-      yield();
-      delay(1000);
-      yield();
-      sendReset(2000);
-    }
-    // sets back the timer for eval against RESET_TIME secs
-    m_lastTimeHeartBeatChanged = currentTime;
-    // cooldown should start now!
-    m_coolDownEnd = currentTime + m_coolDownTimeTrigger;
-  }
-  else
+  consumeEdges(currentTime);
+  consumeProbes(currentTime);
+
+  // one pass over all targets; a target being recovered is left alone
+  // until its waveform is done
+  for(uint8_t t = 0; t < m_targetCount; t++)
   {
-    // board is alive, so reset flags
+    if(!supervised(t) || recovering(t))
+      continue;
+    // returns true if board is off or locked up
+    if(lockedUp(t, currentTime))
+      recover(t, currentTime);
 #if PRINT_VERBOSE
-    char buf[256];
-    sprintf(buf,"=SC:[%02lu:%02lu:%02lu.%03lu] Last value: %d - changed %lu ms ago!\n", hour,
-      minute, second, remainder, m_lastHeartBeatValue, currentTime - m_lastTimeHeartBeatChanged );
-    MemLogger::instance()->logMessage(buf);
+    else
+      MemLogger::logDeferred(LOGMSG_SC_LAST_VALUE, t, currentTime - m_lastTimeHeartBeatChanged[t]);
 #endif
   }
+  armDeadline(currentTime);
 }
@@ -0,0 +1,266 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <SerialBridge.h>
+#include <Constants.h>
+#include <MemLogger.h>
+#include <Metrics.h>
+
+#include <WebSerialPro.h>
+#include <driver/uart.h>
+
+#define SERIAL_BRIDGE_UART    UART_NUM_0
+#define SERIAL_BRIDGE_TX_PIN  1
+#define SERIAL_BRIDGE_RX_PIN  3
+#define SERIAL_BRIDGE_TX_EVENT UART_EVENT_MAX // posted by queueInput, not by the driver
+
+static_assert(SERIAL_BRIDGE_TX_BUFFER >= WEBSERIAL_MAX_CLIENTS * WEBSERIAL_INPUT_WINDOW,
+  "the transmit ring must hold the input window of every client");
+static_assert(SERIAL_BRIDGE_TX_OVERFLOWS >= WEBSERIAL_MAX_CLIENTS,
+  "every client needs room for its dropped input");
+
+SpscByteRing<SERIAL_BRIDGE_TX_BUFFER> SerialBridge::s_txData;
+SpscRing<ConsoleInput, SERIAL_BRIDGE_TX_INPUTS> SerialBridge::s_txInputs;
+ConsoleOverflow SerialBridge::s_txOverflows[SERIAL_BRIDGE_TX_OVERFLOWS];
+portMUX_TYPE SerialBridge::s_txOverflowMux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t validBaud(uint32_t baud)
+{
+  return baud >= MIN_CONSOLE_BAUD && baud <= MAX_CONSOLE_BAUD ? baud : DEFAULT_CONSOLE_BAUD;
+}
+
+bool SerialBridge::begin(uint32_t baud)
+{
+  m_baud = validBaud(baud);
+  uart_config_t config = {
+    .baud_rate = (int)m_baud,
+    .data_bits = UART_DATA_8_BITS,
+    .parity = UART_PARITY_DISABLE,
+    .stop_bits = UART_STOP_BITS_1,
+    .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+    .rx_flow_ctrl_thresh = 0,
+    .use_ref_tick = false
+  };
+  if(uart_param_config(SERIAL_BRIDGE_UART, &config) != ESP_OK ||
+     uart_set_pin(SERIAL_BRIDGE_UART, SERIAL_BRIDGE_TX_PIN, SERIAL_BRIDGE_RX_PIN, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE) != ESP_OK ||
+     // no driver transmit ring, feed() fills the FIFO from the input ring
+     uart_driver_install(SERIAL_BRIDGE_UART, SERIAL_BRIDGE_RX_BUFFER, 0, SERIAL_BRIDGE_EVENTS, &m_events, 0) != ESP_OK)
+  {
+    MemLogger::instance()->logMessage("=SB: UART driver install failed!\n");
+    return false;
+  }
+  xTaskCreatePinnedToCore(eventTask, "serial", SERIAL_TASK_STACK, this,
+    SERIAL_TASK_PRIORITY, NULL, SERIAL_TASK_CORE);
+  MemLogger::instance()->logEvent(LOGMSG_SB_STARTED, m_baud);
+  return true;
+}
+
+bool SerialBridge::setBaud(uint32_t baud)
+{
+  baud = validBaud(baud);
+  if(!m_events || baud == m_baud)
+    return false;
+  if(uart_set_baudrate(SERIAL_BRIDGE_UART, baud) != ESP_OK)
+    return false;
+  m_baud = baud;
+  MemLogger::instance()->logEvent(LOGMSG_SB_STARTED, m_baud);
+  return true;
+}
+
+// copies the fragment into the transmit ring and wakes the task; input
+// that does not fit is dropped but still acknowledged in order
+bool SerialBridge::queueInput(uint32_t client, const uint8_t* data, size_t len, bool last)
+{
+  if(!m_events)
+  {
+    // no bridge task that could acknowledge it, so the page is told here
+    Metrics::instance()->add(METRIC_CONSOLE_INPUT_DROPPED, len);
+    WebSerialPro.ack(client, len, true);
+    return false;
+  }
+  uart_event_t event;
+  event.type = SERIAL_BRIDGE_TX_EVENT;
+  event.size = 0;
+  if(overflow(client, len))
+  {
+    Metrics::instance()->add(METRIC_CONSOLE_INPUT_DROPPED, len);
+    xQueueSend(m_events, &event, 0);
+    return false;
+  }
+  ConsoleInput input = { client, (uint32_t)len, last, !s_txData.write(data, len) };
+  if(input.dropped)
+    Metrics::instance()->add(METRIC_CONSOLE_INPUT_DROPPED, len);
+  s_txInputs.push(input);
+  xQueueSend(m_events, &event, 0);
+  return !input.dropped;
+}
+
+// true if the fragment has to wait in s_txOverflows: the fragment ring is
+// full, or input of the client is waiting there already and this has to
+// come after it. Only queueInput pushes, so the ring cannot fill up
+// between this check and the push.
+bool SerialBridge::overflow(uint32_t client, size_t len)
+{
+  bool full = s_txInputs.size() == SERIAL_BRIDGE_TX_INPUTS;
+  int spare = -1;
+  portENTER_CRITICAL(&s_txOverflowMux);
+  for(int i = 0; i < SERIAL_BRIDGE_TX_OVERFLOWS; i++)
+  {
+    if(s_txOverflows[i].pending && s_txOverflows[i].client == client)
+    {
+      s_txOverflows[i].len += len;
+      portEXIT_CRITICAL(&s_txOverflowMux);
+      return true;
+    }
+    if(spare < 0 && !s_txOverflows[i].pending)
+      spare = i;
+  }
+  // no free entry means more clients than WebSerialPro has slots for,
+  // this one gets no acknowledgements anyway
+  if(full && spare >= 0)
+  {
+    s_txOverflows[spare].client = client;
+    s_txOverflows[spare].len = len;
+    s_txOverflows[spare].pending = true;
+  }
+  portEXIT_CRITICAL(&s_txOverflowMux);
+  return full;
+}
+
+// once the fragment ring is empty, everything queued before the dropped
+// input was acknowledged, so it is now
+void SerialBridge::ackOverflows()
+{
+  for(int i = 0; i < SERIAL_BRIDGE_TX_OVERFLOWS; i++)
+  {
+    portENTER_CRITICAL(&s_txOverflowMux);
+    ConsoleOverflow dropped = s_txOverflows[i];
+    s_txOverflows[i].pending = false;
+    portEXIT_CRITICAL(&s_txOverflowMux);
+    if(dropped.pending)
+      WebSerialPro.ack(dropped.client, dropped.len, true);
+  }
+}
+
+// moves browser input into the UART FIFO as far as it has room, without
+// waiting; true while input is left for the next pass
+bool SerialBridge::feed()
+{
+  for(;;)
+  {
+    if(!m_txActive)
+    {
+      if(!s_txInputs.pop(m_txInput))
+      {
+        ackOverflows();
+        return false;
+      }
+      m_txLeft = m_txInput.dropped ? 0 : m_txInput.len;
+      m_txEol = m_txInput.last && !m_txInput.dropped ? 2 : 0;
+      m_txActive = true;
+    }
+    while(m_txLeft)
+    {
+      const uint8_t* data;
+      uint16_t n = s_txData.peek(data);
+      int written = uart_tx_chars(SERIAL_BRIDGE_UART, (const char*)data, n < m_txLeft ? n : m_txLeft);
+      if(written <= 0)
+        return true;
+      s_txData.consume(written);
+      m_txLeft -= written;
+      Metrics::instance()->add(METRIC_CONSOLE_TX_BYTES, written);
+    }
+    while(m_txEol)
+    {
+      int written = uart_tx_chars(SERIAL_BRIDGE_UART, "\r\n" + 2 - m_txEol, m_txEol);
+      if(written <= 0)
+        return true;
+      m_txEol -= written;
+    }
+    WebSerialPro.ack(m_txInput.client, m_txInput.len, m_txInput.dropped);
+    m_txActive = false;
+  }
+}
+
+// everything the ring holds, in chunks; WebSerialPro frames them
+void SerialBridge::drain()
+{
+  uint8_t chunk[SERIAL_BRIDGE_CHUNK];
+  size_t avail = 0;
+  uart_get_buffered_data_len(SERIAL_BRIDGE_UART, &avail);
+  while(avail)
+  {
+    int n = uart_read_bytes(SERIAL_BRIDGE_UART, chunk, avail < sizeof(chunk) ? avail : sizeof(chunk), 0);
+    if(n <= 0)
+      break;
+    Metrics::instance()->add(METRIC_CONSOLE_BYTES, n);
+    WebSerialPro.write(chunk, n);
+    avail -= n;
+  }
+}
+
+// the only task that sends WebSerial output; waking up at least every
+// WEBSERIAL_FLUSH_MS flushes a partial frame in time. While browser input
+// waits for room in the FIFO it wakes up every tick instead.
+void SerialBridge::eventTask(void* arg)
+{
+  SerialBridge* bridge = reinterpret_cast<SerialBridge*>(arg);
+  uart_event_t event;
+  bool sending = false;
+  for(;;)
+  {
+    if(xQueueReceive(bridge->m_events, &event, sending ? 1 : pdMS_TO_TICKS(WEBSERIAL_FLUSH_MS)))
+    {
+      switch(event.type)
+      {
+        case UART_DATA:
+          bridge->drain();
+          break;
+        // the hardware FIFO or the ring ran over, what they hold is still good
+        case UART_FIFO_OVF:
+          Metrics::instance()->count(METRIC_CONSOLE_FIFO_OVERRUNS);
+          bridge->drain();
+          break;
+        case UART_BUFFER_FULL:
+          Metrics::instance()->count(METRIC_CONSOLE_RING_OVERRUNS);
+          bridge->drain();
+          break;
+        case UART_FRAME_ERR:
+        case UART_PARITY_ERR:
+          Metrics::instance()->count(METRIC_CONSOLE_FRAME_ERRORS);
+          break;
+        default:
+          break;
+      }
+    }
+    sending = bridge->feed();
+    WebSerialPro.iterate();
+  }
+}
@@ -0,0 +1,142 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+#include <Storage.h>
+#include <MemLogger.h>
+
+#include <LITTLEFS.h>
+
+Storage::Storage()
+  : m_mounted(false), m_cachedCount(0)
+{
+  m_lock = xSemaphoreCreateRecursiveMutex();
+}
+
+bool Storage::mount()
+{
+  lock();
+  if(!m_mounted)
+  {
+    m_mounted = LITTLEFS.begin();
+    MemLogger::instance()->logMessage(m_mounted ? "=ST: Mounted file system\n" : "=ST: File System issue!\n");
+  }
+  unlock();
+  return m_mounted;
+}
+
+bool Storage::readFile(const char* path, std::unique_ptr<char[]>& buf, size_t& size)
+{
+  bool ok = false;
+  lock();
+  File file = m_mounted ? LITTLEFS.open(path, "r") : File();
+  if(file)
+  {
+    size = file.size();
+    buf.reset(new char[size + 1]);
+    ok = file.readBytes(buf.get(), size) == size;
+    buf[size] = 0;
+    file.close();
+  }
+  unlock();
+  return ok;
+}
+
+bool Storage::remove(const char* path)
+{
+  lock();
+  dropCached(path);
+  bool ok = m_mounted && LITTLEFS.remove(path);
+  unlock();
+  return ok;
+}
+
+int Storage::openCached(const char* path, size_t& size)
+{
+  int handle = -1;
+  lock();
+  for(int i = 0; i < m_cachedCount && handle < 0; i++)
+    if(!strcmp(m_cached[i].path, path))
+      handle = i;
+  if(handle >= 0 && !m_cached[handle].file)
+  {
+    // removed since it was cached, the handle stays and the file is
+    // opened again if it is back
+    File file = m_mounted ? LITTLEFS.open(path, "r") : File();
+    m_cached[handle].file = file;
+    m_cached[handle].size = file ? file.size() : 0;
+    if(!file)
+      handle = -1;
+  }
+  if(handle < 0 && m_mounted && m_cachedCount < STORAGE_MAX_CACHED && strlen(path) < STORAGE_PATH_SIZE)
+  {
+    File file = LITTLEFS.open(path, "r");
+    if(file)
+    {
+      handle = m_cachedCount++;
+      strcpy(m_cached[handle].path, path);
+      m_cached[handle].file = file;
+      m_cached[handle].size = file.size();
+    }
+  }
+  if(handle >= 0)
+    size = m_cached[handle].size;
+  unlock();
+  return handle;
+}
+
+size_t Storage::readCached(int handle, size_t offset, uint8_t* buf, size_t len)
+{
+  size_t n = 0;
+  lock();
+  if(handle >= 0 && handle < m_cachedCount && m_cached[handle].file && offset < m_cached[handle].size)
+  {
+    CachedFile& cached = m_cached[handle];
+    if(len > cached.size - offset)
+      len = cached.size - offset;
+    if(cached.file.position() == offset || cached.file.seek(offset))
+      n = cached.file.read(buf, len);
+  }
+  unlock();
+  return n;
+}
+
+// a file that is removed is closed, reads of the handle return nothing
+// instead of stale data until openCached finds the file again
+void Storage::dropCached(const char* path)
+{
+  for(int i = 0; i < m_cachedCount; i++)
+  {
+    if(!strcmp(m_cached[i].path, path) && m_cached[i].file)
+    {
+      m_cached[i].file.close();
+      m_cached[i].size = 0;
+    }
+  }
+}
@@ -33,13 +33,17 @@
 #include <SanityChecker.h>
 #include <ConfigManager.h>
 #include <MemLogger.h>
+#include <Metrics.h>
+#include <LoopProfiler.h>
+#include <Storage.h>
+#include <WebUI.h>
+#include <SerialBridge.h>
 
 #include <WiFi.h>
 #include <ESPAsyncWebServer.h>
 #include <AsyncElegantOTA.h>
 #include "AsyncJson.h"
 #include "ArduinoJson.h"
-#include <LITTLEFS.h>
 #include <SD.h>
 
 #include <WebSerialPro.h>
@@ -47,22 +51,26 @@
 extern int lastHeartBeatValue;
 
 // INTERFACES FOR SERVING WEB
-const char* sendResetMsg(unsigned long timePullDown)
+const char* sendResetMsg(uint8_t target, unsigned long timePullDown)
 {
   MemLogger::instance()->logMessage("=WM: Send Reset...\n");
-  SanityChecker::instance()->sendReset(timePullDown);
+  if(!SanityChecker::instance()->post(WD_CMD_RESET, target, timePullDown))
+    return "BUSY";
   return "";
 }
 
-const char* sendPowerMsg(unsigned long timePullDown)
+const char* sendPowerMsg(uint8_t target, unsigned long timePullDown)
 {
   MemLogger::instance()->logMessage("=WM: Send Power...\n");
-  SanityChecker::instance()->sendPower(timePullDown);
+  if(!SanityChecker::instance()->post(WD_CMD_POWER, target, timePullDown))
+    return "BUSY";
   return "";
 }
 
 const char* restartESP()
 {
+  // a change still waiting for its debounce would be lost
+  ConfigManager::instance()->flush();
   ESP.restart();
   return "";
 }
@@ -70,17 +78,33 @@ const char* restartESP()
 void saveConfig(const char* val)
 {
   ConfigManager::instance()->setConfigJson(val);
+  // the console baud applies right away, the rest after a restart
+  BoardConfig* boardcfg = reinterpret_cast<BoardConfig*>(ConfigManager::instance()->getConfig(CONFIG_TYPE::BOARD));
+  SerialBridge::instance()->setBaud(boardcfg->consoleBaud);
 }
 
-void setState(const bool state)
+void setState(uint8_t target, const bool state)
 {
-  SanityChecker::instance()->setState(state);
+  ConfigManager::instance()->setState(target, state);
+  SanityChecker::instance()->setState(target, state);
 }
 
-const char* getConfig()
+// ?target=<n> of the request, the first target if missing; false if the
+// target does not exist, the request has been answered then
+bool targetParam(AsyncWebServerRequest *request, uint8_t& target)
 {
-  size_t sz;
-  return ConfigManager::instance()->getConfigJson(sz);
+  target = 0;
+  if(request->hasParam("target"))
+  {
+    long t = strtol(request->getParam("target")->value().c_str(), NULL, 10);
+    if(t < 0 || t >= SanityChecker::instance()->targetCount())
+    {
+      request->send(404, "text/plain", "Unknown target");
+      return false;
+    }
+    target = t;
+  }
+  return true;
 }
 
 const char* getFWVersion()
@@ -90,30 +114,392 @@ const char* getFWVersion()
 
 #define BUFSZ 2048
 char blubber [BUFSZ];
-const char* popLogMsg()
+const char* popLogMsg(uint32_t& cursor)
 {
-  const char* x = MemLogger::instance()->popLog();
-  unsigned stl = strlen(x);
-  unsigned int len2copy = stl > (BUFSZ-1) ? (BUFSZ-1) : stl;
-  memcpy(blubber,x,len2copy);
-  blubber[len2copy] = '\0';
+  MemLogger::instance()->readSince(cursor, blubber, BUFSZ);
   return blubber;
 }
 
-const char* currentPowerStatus()
+// where a log reader that has seen up to seq continues; new readers and
+// readers from before a reboot get the recent history only
+uint32_t logResumePoint(uint32_t seq)
+{
+  uint32_t last = MemLogger::instance()->lastSeq();
+  if(seq > last || last - seq > LOG_STREAM_CATCHUP)
+    seq = last > LOG_STREAM_CATCHUP ? last - LOG_STREAM_CATCHUP : 0;
+  return seq;
+}
+
+// the log after cursor as one server-sent event of at most size bytes,
+// framed the way AsyncEventSource frames it; 0 if there is nothing new
+size_t renderLogEvent(uint32_t& cursor, char* out, size_t size)
 {
-  char b[8];
-  sprintf(b,"%d",SanityChecker::instance()->currentPowerStatus());
-  return std::string(b).c_str();
+  char text[LOG_STREAM_CHUNK];
+  // fewer records if the framing does not fit
+  for(size_t cap = size < sizeof(text) ? size : sizeof(text); cap > LOG_STREAM_MIN_CHUNK; cap /= 2)
+  {
+    uint32_t next = cursor;
+    size_t len = MemLogger::instance()->readSince(next, text, cap);
+    if(!len)
+      return 0;
+    int n = snprintf(out, size, "id: %u\r\nevent: log\r\n", next);
+    bool fits = n > 0 && (size_t)n < size;
+    size_t used = fits ? n : 0;
+    const char* line = text;
+    const char* end = text + len;
+    while(fits && line < end)
+    {
+      const char* eol = reinterpret_cast<const char*>(memchr(line, '\n', end - line));
+      size_t lineLen = (eol ? eol : end) - line;
+      fits = used + lineLen + 10 <= size; // data: , line end and the closing blank line
+      if(fits)
+        used += sprintf(out + used, "data: %.*s\r\n", (int)lineLen, line);
+      line += lineLen + 1;
+    }
+    if(fits)
+    {
+      memcpy(out + used, "\r\n", 2);
+      cursor = next;
+      return used + 2;
+    }
+  }
+  return 0;
 }
 
-const char* currentHBVal()
+String currentPowerStatus(uint8_t target)
 {
-  char b[8];
-  sprintf(b,"%d",SanityChecker::instance()->lastHeatBeatVal());
-  return std::string(b).c_str();
+  return String(SanityChecker::instance()->currentPowerStatus(target));
 }
 
+// status of every target as JSON
+void sendTargets(AsyncWebServerRequest *request)
+{
+  SanityChecker* checker = SanityChecker::instance();
+  unsigned long now = millis();
+  AsyncResponseStream *response = request->beginResponseStream("application/json");
+  response->print("[");
+  for(uint8_t t = 0; t < checker->targetCount(); t++)
+  {
+    response->printf("%s{\"target\":%u,\"supervised\":%d,\"state\":%d,\"heartbeat\":%d,\"power\":%d}",
+      t ? "," : "", (unsigned)t, checker->supervised(t), checker->state(t, now),
+      checker->lastHeatBeatVal(t), checker->currentPowerStatus(t));
+  }
+  response->print("]");
+  request->send(response);
+}
+
+// everything that changes at runtime in one small response, for polling;
+// times are in ms, logSeq is the newest record for /log?since=
+void sendStatus(AsyncWebServerRequest *request)
+{
+  SanityChecker* checker = SanityChecker::instance();
+  unsigned long now = millis();
+  AsyncResponseStream *response = request->beginResponseStream("application/json");
+  response->addHeader("Cache-Control", "no-store");
+  response->printf("{\"uptime\":%lu,\"heap\":%u,\"logSeq\":%u,\"targets\":[",
+    now, (unsigned)ESP.getFreeHeap(), (unsigned)MemLogger::instance()->lastSeq());
+  for(uint8_t t = 0; t < checker->targetCount(); t++)
+  {
+    response->printf("%s{\"state\":%d,\"enabled\":%d,\"power\":%d,\"heartbeat\":%d,\"sinceEdge\":%lu,\"cooldown\":%lu,\"lockups\":%u,\"probes\":%u,\"probesUp\":%u,\"quorum\":%u}",
+      t ? "," : "", checker->state(t, now), checker->enabled(t), checker->currentPowerStatus(t),
+      checker->lastHeatBeatVal(t), checker->sinceLastEdge(t, now), checker->coolDownRemaining(t, now),
+      (unsigned)checker->lockups(t), checker->probes(t), checker->probesUp(t, now), checker->quorum(t));
+  }
+  response->print("]}");
+  request->send(response);
+}
+
+// heartbeat interval statistics in us as JSON, histogram as [lower, count]
+// pairs of the non-empty buckets
+void sendHeartBeatStats(AsyncWebServerRequest *request)
+{
+  uint8_t target;
+  if(!targetParam(request, target))
+    return;
+  if(request->hasParam("reset"))
+    SanityChecker::instance()->resetHeartBeatStats();
+
+  IntervalStats stats;
+  SanityChecker::instance()->heartBeatStats(target, stats);
+  unsigned long lockupUs = SanityChecker::instance()->lockupTime(target) * 1000;
+  AsyncResponseStream *response = request->beginResponseStream("application/json");
+  response->printf("{\"count\":%u,\"min\":%u,\"max\":%u,\"mean\":%.0f,\"stddev\":%.0f,",
+    (unsigned)stats.count(), (unsigned)stats.min(), (unsigned)stats.max(), stats.mean(), sqrt(stats.variance()));
+  response->printf("\"p50\":%u,\"p99\":%u,\"p999\":%u,\"lockup\":%lu,\"headroom\":%ld,\"histogram\":[",
+    (unsigned)stats.percentile(0.5), (unsigned)stats.percentile(0.99), (unsigned)stats.percentile(0.999), lockupUs, (long)lockupUs - (long)stats.max());
+  bool first = true;
+  for(int i = 0; i < INTERVALSTATS_BUCKETS; i++)
+  {
+    if(!stats.bucketCount(i))
+      continue;
+    response->printf("%s[%u,%u]", first ? "" : ",", (unsigned)IntervalStats::bucketLower(i), (unsigned)stats.bucketCount(i));
+    first = false;
+  }
+  // how long edges wait for the watchdog task, reuses the copy above
+  SanityChecker::instance()->edgeLatencyStats(stats);
+  response->printf("],\"latency\":{\"p50\":%u,\"p99\":%u,\"max\":%u}}",
+    (unsigned)stats.percentile(0.5), (unsigned)stats.percentile(0.99), (unsigned)stats.max());
+  request->send(response);
+}
+
+// Prometheus text format, rendered line by line from a snapshot straight
+// into the send buffer; the length is known up front so no chunking
+class MetricsResponse : public AsyncAbstractResponse
+{
+public:
+  MetricsResponse() : m_line(0), m_offset(0), m_lineLen(0)
+  {
+    _code = 200;
+    _contentType = "text/plain; version=0.0.4";
+
+    Metrics::instance()->snapshot(m_snapshot);
+    m_snapshot.gauges[GAUGE_UPTIME] = millis() / 1000;
+    m_snapshot.gauges[GAUGE_FREE_HEAP] = ESP.getFreeHeap();
+    m_snapshot.gauges[GAUGE_MIN_FREE_HEAP] = ESP.getMinFreeHeap();
+    m_snapshot.gauges[GAUGE_WIFI_RSSI] = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+    m_snapshot.gauges[GAUGE_CONFIG_LOAD] = ConfigManager::instance()->loadMicros();
+    m_snapshot.gauges[GAUGE_WATCHDOG_ARMED] = SanityChecker::instance()->armedMicros();
+    m_snapshot.targetCount = SanityChecker::instance()->targetCount();
+    for(uint8_t t = 0; t < m_snapshot.targetCount; t++)
+      m_snapshot.targetStates[t] = SanityChecker::instance()->state(t, millis());
+
+    _contentLength = 0;
+    for(uint16_t line = 0; (m_lineLen = Metrics::renderLine(m_snapshot, line, m_lineBuf, sizeof(m_lineBuf))); line++)
+      _contentLength += m_lineLen;
+    m_lineLen = 0;
+  }
+  bool _sourceValid() const { return true; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen)
+  {
+    size_t filled = 0;
+    while(filled < maxLen)
+    {
+      if(m_offset == m_lineLen)
+      {
+        m_lineLen = Metrics::renderLine(m_snapshot, m_line, m_lineBuf, sizeof(m_lineBuf));
+        m_offset = 0;
+        if(!m_lineLen)
+          break;
+        m_line++;
+      }
+      size_t n = m_lineLen - m_offset;
+      if(n > maxLen - filled)
+        n = maxLen - filled;
+      memcpy(buf + filled, m_lineBuf + m_offset, n);
+      m_offset += n;
+      filled += n;
+    }
+    return filled;
+  }
+private:
+  MetricsSnapshot m_snapshot;
+  char m_lineBuf[METRICS_LINE_SIZE];
+  uint16_t m_line;
+  size_t m_offset;
+  size_t m_lineLen;
+};
+
+// static file streamed from a handle the Storage keeps open; every chunk
+// is read at its offset, so parallel responses can share the handle
+class StorageResponse : public AsyncAbstractResponse
+{
+public:
+  StorageResponse(int handle, size_t size, const char* contentType) : m_handle(handle), m_offset(0)
+  {
+    _code = 200;
+    _contentType = contentType;
+    _contentLength = size;
+  }
+  bool _sourceValid() const { return m_handle >= 0; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen)
+  {
+    size_t n = Storage::instance()->readCached(m_handle, m_offset, buf, maxLen);
+    m_offset += n;
+    return n;
+  }
+private:
+  int m_handle;
+  size_t m_offset;
+};
+
+// sends the cached config without copying it; holding the buffer keeps it
+// alive if the config changes while the response is under way
+class ConfigJsonResponse : public AsyncAbstractResponse
+{
+public:
+  ConfigJsonResponse(const ConfigJsonPtr& json) : m_json(json), m_offset(0)
+  {
+    _code = 200;
+    _contentType = "application/json";
+    _contentLength = json->size;
+  }
+  bool _sourceValid() const { return !!m_json; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen)
+  {
+    size_t n = min(maxLen, m_json->size - m_offset);
+    memcpy(buf, m_json->data.get() + m_offset, n);
+    m_offset += n;
+    return n;
+  }
+private:
+  ConfigJsonPtr m_json;
+  size_t m_offset;
+};
+
+typedef struct
+{
+  char path[STORAGE_PATH_SIZE];
+  char etag[ASSET_ETAG_SIZE];
+  bool gzip; // stored as <path>.gz only
+} AssetEntry;
+
+AssetEntry assets[ASSET_MAX_COUNT];
+int assetCount = 0;
+
+// one "<path> <etag> <gzip>" line per asset; without the index, e.g. on a
+// file system built by hand, the files are served as they are
+void loadAssetIndex()
+{
+  std::unique_ptr<char[]> buf;
+  size_t size;
+  assetCount = 0;
+  if(!Storage::instance()->readFile(ASSET_INDEX_NAME, buf, size))
+  {
+    MemLogger::instance()->logMessage("=WM: No asset index, serving files uncached\n");
+    return;
+  }
+  char* save;
+  for(char* line = strtok_r(buf.get(), "\n", &save); line && assetCount < ASSET_MAX_COUNT; line = strtok_r(NULL, "\n", &save))
+  {
+    AssetEntry& asset = assets[assetCount];
+    int gzip;
+    // widths follow STORAGE_PATH_SIZE and ASSET_ETAG_SIZE
+    if(sscanf(line, "%31s %16s %d", asset.path, asset.etag, &gzip) == 3)
+    {
+      asset.gzip = gzip;
+      assetCount++;
+    }
+  }
+}
+
+const AssetEntry* findAsset(const char* path)
+{
+  for(int i = 0; i < assetCount; i++)
+    if(!strcmp(assets[i].path, path))
+      return &assets[i];
+  return NULL;
+}
+
+// answers 304 if the client holds this version already
+bool sendNotModified(AsyncWebServerRequest *request, const char* etag, const char* cacheControl)
+{
+  AsyncWebHeader* match = request->getHeader("If-None-Match");
+  if(!match || match->value().indexOf(etag) < 0)
+    return false;
+  AsyncWebServerResponse *response = request->beginResponse(304);
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", cacheControl);
+  request->send(response);
+  return true;
+}
+
+#if WEBUI_EMBEDDED
+// the whole UI in one response straight from flash, it loads even if the
+// file system is gone
+void sendWebUI(AsyncWebServerRequest *request)
+{
+  if(sendNotModified(request, WEBUI_ETAG, "no-cache"))
+    return;
+  AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", WEBUI_HTML, WEBUI_HTML_SIZE);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", WEBUI_ETAG);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+#endif
+
+// the page is revalidated on every load, what it refers to is versioned by
+// its hash and cached for good
+void sendStatic(AsyncWebServerRequest *request, const char* path, const char* contentType)
+{
+  const AssetEntry* asset = findAsset(path);
+  const char* cacheControl = strcmp(contentType, "text/html") ? ASSET_CACHE_LONG : "no-cache";
+  char etag[ASSET_ETAG_SIZE + 2];
+  if(asset)
+  {
+    snprintf(etag, sizeof(etag), "\"%s\"", asset->etag);
+    if(sendNotModified(request, etag, cacheControl))
+      return;
+  }
+
+  char stored[STORAGE_PATH_SIZE];
+  snprintf(stored, sizeof(stored), asset && asset->gzip ? "%s.gz" : "%s", path);
+  size_t size;
+  int handle = Storage::instance()->openCached(stored, size);
+  if(handle < 0)
+  {
+    request->send(404);
+    return;
+  }
+  AsyncWebServerResponse *response = new StorageResponse(handle, size, contentType);
+  if(asset)
+  {
+    if(asset->gzip)
+      response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", cacheControl);
+  }
+  request->send(response);
+}
+
+#if LOOP_PROFILER
+// one section of the loop profile as JSON, cycles converted to us
+void printLoopStats(AsyncResponseStream *response, const IntervalStats& stats, double mhz)
+{
+  response->printf("{\"count\":%u,\"min\":%.2f,\"max\":%.2f,\"mean\":%.2f,\"p50\":%.2f,\"p99\":%.2f,\"histogram\":[",
+    (unsigned)stats.count(), stats.min() / mhz, stats.max() / mhz, stats.mean() / mhz,
+    stats.percentile(0.5) / mhz, stats.percentile(0.99) / mhz);
+  bool first = true;
+  for(int i = 0; i < INTERVALSTATS_BUCKETS; i++)
+  {
+    if(!stats.bucketCount(i))
+      continue;
+    response->printf("%s[%.2f,%u]", first ? "" : ",", IntervalStats::bucketLower(i) / mhz, (unsigned)stats.bucketCount(i));
+    first = false;
+  }
+  response->print("]}");
+}
+
+// period of each task loop and time per section in us
+void sendLoopProfile(AsyncWebServerRequest *request)
+{
+  if(request->hasParam("reset"))
+    LoopProfiler::instance()->reset();
+
+  // one section at a time, the stats are too big to copy all of them onto
+  // the stack of the web server task
+  IntervalStats stats;
+  double mhz = LoopProfiler::instance()->cyclesPerMicro();
+  AsyncResponseStream *response = request->beginResponseStream("application/json");
+  response->print("{\"periods\":{");
+  for(int i = 0; i < MAXPROFLANES; i++)
+  {
+    response->printf("%s\"%s\":", i ? "," : "", LoopProfiler::laneName((PROF_LANE)i));
+    LoopProfiler::instance()->period((PROF_LANE)i, stats);
+    printLoopStats(response, stats, mhz);
+  }
+  response->print("},\"sections\":{");
+  for(int i = 0; i < MAXPROFSECTIONS; i++)
+  {
+    response->printf("%s\"%s\":", i ? "," : "", LoopProfiler::sectionName((PROF_SECTION)i));
+    LoopProfiler::instance()->section((PROF_SECTION)i, stats);
+    printLoopStats(response, stats, mhz);
+  }
+  response->print("}}");
+  request->send(response);
+}
+#endif
+
 bool WiFiMan::init()
 {
   // Trigger reset from previously saved config file...
@@ -141,8 +527,6 @@ bool WiFiMan::init()
 
 void WiFiMan::iterate()
 {
-  handleSerialData();
-
   if(!m_servelocal)
     return;
 }
@@ -169,137 +553,183 @@ bool WiFiMan::startServe()
   BoardConfig* boardcfg = reinterpret_cast<BoardConfig*>(ConfigManager::instance()->getConfig(CONFIG_TYPE::BOARD));
 
 #if !SERVEFROMSD
-  if(LITTLEFS.begin())
-  {
+  // without the file system only the built-in UI and the API are served
+  if(Storage::instance()->mount())
+    loadAssetIndex();
+  else
+    MemLogger::instance()->logMessage("=WM: File system not mounted\n");
 #endif
 
 #if PRINT_DEBUG
-    // Print ESP32 Local IP Address
-    Serial.println(WiFi.localIP());
+  // Print ESP32 Local IP Address
+  Serial.println(WiFi.localIP());
 #endif
 
-    m_server = new AsyncWebServer(boardcfg->serverPort);
+  m_server = new AsyncWebServer(boardcfg->serverPort);
 
-    // Route for root / web page
-    m_server->on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-  #if SERVEFROMSD
-      request->send(SD, "/index.html");
+  // Route for root / web page
+  m_server->on("/", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_INDEX);
+  #if WEBUI_EMBEDDED
+    sendWebUI(request);
+  #elif SERVEFROMSD
+    request->send(SD, "/index.html");
   #else
-      request->send(LITTLEFS, "/index.html");
+    sendStatic(request, "/index.html", "text/html");
   #endif
-    });
-    m_server->on("/icon.css", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send(LITTLEFS, "/icon.css");
-    });
-    m_server->on("/googlematerials.woff2", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send(LITTLEFS, "/googlematerials.woff2");
-    });
-    m_server->on("/css/materialize.min.css", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send(LITTLEFS, "/css/materialize.min.css");
-    });
-    m_server->on("/js/materialize.min.js", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send(LITTLEFS, "/js/materialize.min.js");
-    });
-    m_server->on("/favicon.ico", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send(LITTLEFS, "/favicon.ico");
-    });
-    AsyncCallbackJsonWebHandler* handler = new AsyncCallbackJsonWebHandler("/saveconfig", [](AsyncWebServerRequest *request, JsonVariant &json) {
-      StaticJsonDocument<512> data;
-      if (json.is<JsonArray>())
-      {
-        data = json.as<JsonArray>();
-      }
-      else if (json.is<JsonObject>())
-      {
-        data = json.as<JsonObject>();
-      }
-      String cfg;
-      serializeJson(data, cfg);
-      saveConfig(cfg.c_str());
-      request->send(200, "text/plain", "OK!");
-    });
-    m_server->addHandler(handler);
-
-    AsyncCallbackJsonWebHandler* handler2 = new AsyncCallbackJsonWebHandler("/wdstate", [](AsyncWebServerRequest *request, JsonVariant &json) {
-      StaticJsonDocument<512> data;
-      if (json.is<JsonArray>())
-      {
-        data = json.as<JsonArray>();
-      }
-      else if (json.is<JsonObject>())
-      {
-        data = json.as<JsonObject>();
-      }
-      setState(data["state"]);
-      request->send(200, "text/plain", "OK!");
-    });
-    m_server->addHandler(handler2);
-
-    m_server->on("/reset", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send_P(200, "text/plain", sendResetMsg(500));
-    });
-
-    m_server->on("/resetESP", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send_P(200, "text/plain", restartESP());
-    });
-    m_server->on("/shutdown", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send_P(200, "text/plain", sendPowerMsg(6000));
-    });
-    m_server->on("/getconfig", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send_P(200, "application/json", getConfig());
-    });
-    m_server->on("/fwversion", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send_P(200, "text/plain", getFWVersion());
-    });
-    m_server->on("/powerstatus", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send_P(200, "text/plain", currentPowerStatus());
-    });
-    m_server->on("/log", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send_P(200, "text/plain", popLogMsg());
-    });
-
-
-    // start update server
-    AsyncElegantOTA.begin(m_server);//m_updateServer);
-    WebSerialPro.begin(m_server);//m_serialserver);
-    WebSerialPro.msgCallback(WiFiMan::recvMsg);
-
-    // Start server
-    m_server->begin();
-
-    return true;
-#if !SERVEFROMSD
-  }
-  return false;
+  });
+  m_server->on("/icon.css", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_ASSET);
+    sendStatic(request, "/icon.css", "text/css");
+  });
+  m_server->on("/googlematerials.woff2", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_ASSET);
+    sendStatic(request, "/googlematerials.woff2", "font/woff2");
+  });
+  m_server->on("/css/materialize.min.css", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_ASSET);
+    sendStatic(request, "/css/materialize.min.css", "text/css");
+  });
+  m_server->on("/js/materialize.min.js", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_ASSET);
+    sendStatic(request, "/js/materialize.min.js", "application/javascript");
+  });
+  m_server->on("/favicon.ico", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_ASSET);
+    sendStatic(request, "/favicon.ico", "image/x-icon");
+  });
+  // the page posts the whole config, so the document has room for all targets
+  AsyncCallbackJsonWebHandler* handler = new AsyncCallbackJsonWebHandler("/saveconfig", [](AsyncWebServerRequest *request, JsonVariant &json) {
+    Metrics::instance()->countRequest(ROUTE_SAVECONFIG);
+    String cfg;
+    serializeJson(json, cfg);
+    saveConfig(cfg.c_str());
+    request->send(200, "text/plain", "OK!");
+  }, CONFIGFILE_DEFAULT_SIZE);
+  m_server->addHandler(handler);
+
+  AsyncCallbackJsonWebHandler* handler2 = new AsyncCallbackJsonWebHandler("/wdstate", [](AsyncWebServerRequest *request, JsonVariant &json) {
+    Metrics::instance()->countRequest(ROUTE_WDSTATE);
+    uint8_t target = json["target"] | 0;
+    if(target >= SanityChecker::instance()->targetCount())
+    {
+      request->send(404, "text/plain", "Unknown target");
+      return;
+    }
+    setState(target, json["state"]);
+    request->send(200, "text/plain", "OK!");
+  }, CONFIGFILE_DEFAULT_SIZE);
+  m_server->addHandler(handler2);
+
+  m_server->on("/reset", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_RESET);
+    uint8_t target;
+    if(targetParam(request, target))
+      request->send_P(200, "text/plain", sendResetMsg(target, 500));
+  });
+
+  m_server->on("/resetESP", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_RESETESP);
+    request->send_P(200, "text/plain", restartESP());
+  });
+  m_server->on("/shutdown", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_SHUTDOWN);
+    uint8_t target;
+    if(targetParam(request, target))
+      request->send_P(200, "text/plain", sendPowerMsg(target, 6000));
+  });
+  m_server->on("/getconfig", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_GETCONFIG);
+    ConfigJsonPtr json = ConfigManager::instance()->getConfigJson();
+    if(sendNotModified(request, json->etag, "no-cache"))
+      return;
+    AsyncWebServerResponse *response = new ConfigJsonResponse(json);
+    response->addHeader("ETag", json->etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+  });
+  m_server->on("/fwversion", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_FWVERSION);
+    request->send_P(200, "text/plain", getFWVersion());
+  });
+  m_server->on("/hbstats", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_HBSTATS);
+    sendHeartBeatStats(request);
+  });
+  m_server->on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_METRICS);
+    request->send(new MetricsResponse());
+  });
+#if LOOP_PROFILER
+  m_server->on("/profile", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_PROFILE);
+    sendLoopProfile(request);
+  });
 #endif
+  m_server->on("/powerstatus", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_POWERSTATUS);
+    uint8_t target;
+    if(targetParam(request, target))
+      request->send(200, "text/plain", currentPowerStatus(target));
+  });
+  m_server->on("/status", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_STATUS);
+    sendStatus(request);
+  });
+  m_server->on("/targets", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_TARGETS);
+    sendTargets(request);
+  });
+  // polled log, from ?since=<seq> like /logstream from Last-Event-ID;
+  // X-Log-Seq is the cursor for the next request
+  m_server->on("/log", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_LOG);
+    uint32_t since = request->hasParam("since") ? strtoul(request->getParam("since")->value().c_str(), NULL, 10) : UINT32_MAX;
+    uint32_t cursor = logResumePoint(since);
+    AsyncWebServerResponse *response = request->beginResponse(200, "text/plain", popLogMsg(cursor));
+    response->addHeader("X-Log-Seq", String(cursor));
+    request->send(response);
+  });
+
+  // pushed log as server-sent events; the web server task fills the stream
+  // whenever the connection has room, so no other task touches its
+  // clients, and every client resumes from its own Last-Event-ID
+  m_server->on("/logstream", HTTP_GET, [](AsyncWebServerRequest *request){
+    Metrics::instance()->countRequest(ROUTE_LOGSTREAM);
+    AsyncWebHeader* lastId = request->getHeader("Last-Event-ID");
+    uint32_t cursor = logResumePoint(lastId ? strtoul(lastId->value().c_str(), NULL, 10) : UINT32_MAX);
+    AsyncWebServerResponse *response = request->beginChunkedResponse("text/event-stream",
+      [cursor](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+        size_t len = renderLogEvent(cursor, reinterpret_cast<char*>(buffer), maxLen);
+        if(len)
+          return len;
+        // a comment, so the headers go out before there is any log
+        if(!index)
+        {
+          memcpy(buffer, ":\r\n", 3);
+          return 3;
+        }
+        return RESPONSE_TRY_AGAIN;
+      });
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+  });
+
+
+  // start update server
+  AsyncElegantOTA.begin(m_server);//m_updateServer);
+  WebSerialPro.begin(m_server);//m_serialserver);
+  WebSerialPro.inputCallback(WiFiMan::recvMsg);
+
+  // Start server
+  m_server->begin();
+
+  return true;
 }
 
-void WiFiMan::recvMsg(uint8_t *data, size_t len)
+// runs in the web server task, the bridge copies the data once and
+// acknowledges it once it is in the UART FIFO
+void WiFiMan::recvMsg(uint32_t client, const uint8_t *data, size_t len, bool last)
 {
-  String d = "";
-  for(int i=0; i < len; i++){
-    d += char(data[i]);
-  }
-  //WebSerialPro.println(d);
-  Serial.println(d);
-
-  /*
-  WebSerialPro.println("Received Data...");
-  String d = "";
-  for(int i=0; i < len; i++){
-    d += char(data[i]);
-  }
-  WebSerialPro.println(d);
-  */
-}
-
-void WiFiMan::handleSerialData()
-{
-  #if !DEBUG_PRINT
-    if(Serial.available())
-    {
-      String data = Serial.readStringUntil('\n');
-      WebSerialPro.print(data);
-    }
-  #endif
+  SerialBridge::instance()->queueInput(client, data, len, last);
 }
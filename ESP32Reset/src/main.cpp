@@ -33,39 +33,39 @@
 #include <WiFi.h>
 #include <WifiMan.h>
 #include <SanityChecker.h>
+#include <PulseEngine.h>
 #include <MemLogger.h>
+#include <LoopProfiler.h>
 #include <ConfigManager.h>
+#include <Storage.h>
+#include <SerialBridge.h>
+#include <ProbeScheduler.h>
 #include <Constants.h>
+#include <Hal.h>
 
 //====================================================================
 // INTERRUPT DRIVEN RESET ROUTINE
-bool reset_in = false;
+volatile bool reset_in = false;
 void IRAM_ATTR HandleResetButtonInterrupt() {
-    MemLogger::instance()->logMessage("=MAIN: Interrupt from Reset Button!\n");
-    if(!reset_in)
-    {
-      // set 250ms reset...
-      reset_in = true;
-      digitalWrite(ROCKRESET, HIGH);
-      delay(250);
-      digitalWrite(ROCKRESET, LOW);
-    }
-    reset_in = false;
+    MemLogger::logFromIsr(LOGMSG_RESET_BUTTON);
+    // the 250ms reset is queued from the watchdog task, never wait inside the ISR
+    reset_in = true;
+    Hal::wakeWatchdog();
 }
 
 int flash_changes = 0;
 unsigned long flash_OnTime = 0;
-bool flash_ison = false;
+volatile bool flash_ison = false; // set on core 1, read by the service task
 void ICACHE_RAM_ATTR HandleFlashButtonInterrupt()
 {
-    MemLogger::instance()->logMessage("=MAIN: Interrupt from Flash Button!\n");
     flash_changes++;
+    MemLogger::logFromIsr(LOGMSG_FLASH_BUTTON, flash_changes);
     flash_ison = flash_changes % 2;
 }
 
 void resetBoardToFactorySettings()
 {
-    ConfigManager::instance()->deleteConfigFile();
+    ConfigManager::instance()->deleteConfig();
 
     WiFi.mode(WIFI_AP_STA); // cannot erase if not in STA mode !
     WiFi.persistent(true);
@@ -73,9 +73,76 @@ void resetBoardToFactorySettings()
     WiFi.persistent(false);
 }
 
+//====================================================================
+// WATCHDOG TASK, CORE 1
+// sleeps until a pin edge, a deadline, a finished pulse or a web command
+// wakes it up, so nothing on core 0 can delay the heartbeat evaluation
+void watchdogTask(void* arg)
+{
+  Hal::setWatchdogTask(xTaskGetCurrentTaskHandle());
+  while(true)
+  {
+    PROFILE_BEGIN(PROF_LANE_WATCHDOG);
+    if(reset_in)
+    {
+      reset_in = false;
+      if(!PulseEngine::instance()->busy())
+        SanityChecker::instance()->sendReset(0, 250); // the button resets the first target
+      else
+        MemLogger::logDeferred(LOGMSG_RESET_IGNORED);
+    }
+    PulseEngine::instance()->iterate();
+    PROFILE_MARK(PROF_PULSES);
+    SanityChecker::instance()->iterate(millis());
+    PROFILE_MARK(PROF_CHECKER);
+
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WATCHDOG_TASK_IDLE_MS));
+  }
+}
+
+//====================================================================
+// SERVICE TASK, CORE 0
+// flash button, log and storage; may block as long as it
+// likes, the web server runs in its own task next to it
+void serviceTask(void* arg)
+{
+  while(true)
+  {
+    unsigned long currentTime = millis();
+    PROFILE_BEGIN(PROF_LANE_SERVICE);
+
+    if(flash_ison && flash_OnTime == 0)
+    {
+      flash_OnTime = currentTime;
+    }
+    if(!flash_ison && flash_OnTime > 0)
+    {
+      unsigned long len = currentTime - flash_OnTime;
+      MemLogger::instance()->logEvent(LOGMSG_FLASH_PRESSED, len, FLASH_RESET_PERIOD);
+      if(len > FLASH_RESET_PERIOD)
+      {
+        resetBoardToFactorySettings();
+        ESP.restart();
+      }
+      flash_OnTime = 0;
+    }
+    PROFILE_MARK(PROF_BUTTONS);
+
+    MemLogger::instance()->iterate();
+    PROFILE_MARK(PROF_LOGGER);
+    ConfigManager::instance()->iterate(currentTime);
+    PROFILE_MARK(PROF_STORAGE);
+    WiFiMan::instance()->iterate();
+    delay(10);
+    PROFILE_MARK(PROF_IDLE);
+  }
+}
+
 void setup()
 {
+#if PRINT_DEBUG
   Serial.begin(115200);
+#endif
 
   unsigned long currentTime = millis();
 
@@ -92,7 +159,14 @@ void setup()
   ConfigManager::instance();
 
   // INIT SANITY CHECKER
+  // setup runs on core 1 as well, so the pin interrupts are served there
   SanityChecker::instance()->init(currentTime);
+  MemLogger::instance()->logEvent(LOGMSG_WATCHDOG_ARMED, SanityChecker::instance()->armedMicros());
+  xTaskCreatePinnedToCore(watchdogTask, "watchdog", WATCHDOG_TASK_STACK, NULL,
+    WATCHDOG_TASK_PRIORITY, NULL, WATCHDOG_TASK_CORE);
+
+  // mounted once for good, after the watchdog is armed
+  Storage::instance()->mount();
 
   //==========================================================
   // BASIC WIFI SETUP
@@ -101,35 +175,33 @@ void setup()
     MemLogger::instance()->logMessage("=MAIN: Connecting to existing WLAN failed... Will spawn hotspot!\n");
     WiFiMan::instance()->spawnHotSpot();
   }
+  BoardConfig* boardcfg = reinterpret_cast<BoardConfig*>(ConfigManager::instance()->getConfig(CONFIG_TYPE::BOARD));
+#if !PRINT_DEBUG
+  // UART0 carries the board console unless it is used for debug output
+  SerialBridge::instance()->begin(boardcfg->consoleBaud);
+#endif
+
+  // network probes report to the watchdog task; their task only runs if a
+  // target uses one
+  ProbeScheduler::instance()->begin(SanityChecker::probeOk);
+  uint8_t probing = 0;
+  for(uint8_t t = 0; t < SanityChecker::instance()->targetCount(); t++)
+  {
+    uint8_t running = ProbeScheduler::instance()->configure(t, boardcfg->targets[t]);
+    SanityChecker::probesStarted(t, running);
+    probing |= running;
+  }
+  if(probing)
+    xTaskCreatePinnedToCore(ProbeScheduler::task, "probes", PROBE_TASK_STACK, ProbeScheduler::instance(),
+      PROBE_TASK_PRIORITY, NULL, PROBE_TASK_CORE);
   delay(2000);
+
+  xTaskCreatePinnedToCore(serviceTask, "service", SERVICE_TASK_STACK, NULL,
+    SERVICE_TASK_PRIORITY, NULL, SERVICE_TASK_CORE);
 }
 
 void loop()
 {
-  unsigned long currentTime = millis();
-
-  if(flash_ison && flash_OnTime == 0)
-  {
-    flash_OnTime = currentTime;
-  }
-  if(!flash_ison && flash_OnTime > 0)
-  {
-    unsigned long len = currentTime - flash_OnTime;
-    char buf[128];
-    sprintf(buf,"=MAIN: Time Flash button pressed for %lu ms! Press %d secs to reset!\n", len, FLASH_RESET_PERIOD);
-    MemLogger::instance()->logMessage(buf);
-    if(len > FLASH_RESET_PERIOD)
-    {
-      resetBoardToFactorySettings();
-      ESP.restart();
-    }
-    flash_OnTime = 0;
-  }
-
-  // put your main code here, to run repeatedly:
-  SanityChecker::instance()->iterate(currentTime);
-  yield();
-  WiFiMan::instance()->iterate();
-  yield();
-  delay(10);
+  // all work happens in the watchdog and service tasks
+  vTaskDelete(NULL);
 }
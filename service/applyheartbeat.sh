@@ -1,5 +1,14 @@
+# heartbeatd is built on the board
+for tool in ${CXX:-g++} make; do
+  if ! command -v $tool >/dev/null 2>&1; then
+    echo "applyheartbeat.sh: $tool not found, install a C++ compiler first: apt install g++ make" >&2
+    exit 1
+  fi
+done
 cd /mnt/dietpi_userdata &&
 tar -xzf heartbeat.tgz &&
+make -C heartbeat install &&
 cp heartbeat/heartbeat.service /etc/systemd/system/ &&
+systemctl daemon-reload &&
 systemctl enable heartbeat &&
-systemctl start heartbeat
\ No newline at end of file
+systemctl restart heartbeat
@@ -1,39 +0,0 @@
-#!/usr/bin/env python
-
-# Clemens Arth, 2021, LGPLv3 License
-# based on...
-# Frank Mankel, 2018, LGPLv3 License
-# Rock 64 GPIO Library for Python
-# Thanks Allison! Thanks smartdave!
-
-import R64.GPIO as GPIO
-from time import sleep
-
-print("Output Test R64.GPIO Module...")
-
-# Set Variables
-var_gpio_out = 36 # Pin 16 - 148 is Pin 8, 149 is Pin 18
-#var_gpio_in = 18
-
-
-# GPIO Setup
-GPIO.setwarnings(True)
-GPIO.setmode(GPIO.ROCK)
-GPIO.setup(var_gpio_out, GPIO.OUT, initial=GPIO.HIGH)       # Set up GPIO as an output, with an initial state of HIGH
-#GPIO.setup(var_gpio_in, GPIO.IN, pull_up_down=GPIO.PUD_UP)  # Set up GPIO as an input, pullup enabled
-
-# Test Output
-print("")
-print("Testing GPIO Input/Output:")
-
-while True:
-        var_gpio_state = GPIO.input(var_gpio_out)       # Return State of GPIO
-        print("Output State: " + str(var_gpio_state))
-        if var_gpio_state == 1:
-                GPIO.output(var_gpio_out,0)                         # Set GPIO to LOW
-                print("Turning off")              # Print results
-        else:
-                GPIO.output(var_gpio_out,1)                         # Set GPIO to LOW
-                print("Turning on")
-        sleep(1.0)
-exit()
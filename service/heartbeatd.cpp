@@ -0,0 +1,421 @@
+// ESP32 Reset
+// Copyright 2021 AR4 GmbH. All rights reserved.
+// https://www.ar4.io
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name of AR4 GmbH nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Author: clemens@ar4.io (Clemens Arth)
+
+// heartbeatd toggles the heartbeat GPIO that the ESP32 watchdog listens to.
+// It replaces heartbeat.py, which opened and closed three sysfs files per
+// toggle through R64.GPIO and printed every step to the journal. The line
+// is opened once, through sysfs or the GPIO character device, and toggled
+// on an absolute schedule, so the period does not drift and a late wakeup
+// does not delay the next toggle. Nothing is printed while it runs.
+//
+// -s points it at a fake sysfs directory and -b measures the jitter, see
+// README.md. Build with make, run as root or as a member of the gpio group.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <linux/gpio.h>
+
+#include <algorithm>
+#include <vector>
+
+#define HB_DEFAULT_GPIO             36    // pin 16 of the RockPro64, as in heartbeat.py
+#define HB_DEFAULT_PERIOD           1000  // ms between toggles
+#define HB_DEFAULT_SYSFS            "/sys/class/gpio"
+#define HB_EXPORT_WAIT              1000  // ms, udev fixes the permissions of a new export
+#define HB_STACK_PREFAULT           65536 // bytes of stack touched before mlockall
+#define HB_PATH_SIZE                256
+
+static volatile sig_atomic_t s_stop = 0;
+static volatile sig_atomic_t s_reopen = 0;
+
+static void onSignal(int sig)
+{
+  if(sig == SIGHUP)
+    s_reopen = 1;
+  else
+    s_stop = 1;
+}
+
+static long elapsedUs(const timespec& from, const timespec& to)
+{
+  return (to.tv_sec - from.tv_sec) * 1000000L + (to.tv_nsec - from.tv_nsec) / 1000;
+}
+
+static void addMs(timespec& t, unsigned long ms)
+{
+  t.tv_sec += ms / 1000;
+  t.tv_nsec += (ms % 1000) * 1000000L;
+  if(t.tv_nsec >= 1000000000L)
+  {
+    t.tv_sec++;
+    t.tv_nsec -= 1000000000L;
+  }
+}
+
+static bool writeFile(const char* path, const char* text)
+{
+  int fd = open(path, O_WRONLY);
+  if(fd < 0)
+    return false;
+  bool ok = write(fd, text, strlen(text)) == (ssize_t)strlen(text);
+  close(fd);
+  return ok;
+}
+
+// one output line, opened once and kept open
+class GpioLine
+{
+public:
+  virtual ~GpioLine () { }
+  virtual bool open(int initial) = 0;
+  virtual bool set(int value) = 0;
+  virtual void close() = 0;
+  virtual const char* name() const = 0;
+};
+
+// /sys/class/gpio/gpioN/value, written in place through one descriptor
+class SysfsLine : public GpioLine
+{
+public:
+  SysfsLine (const char* root, int gpio, bool reopen) : m_gpio(gpio), m_reopen(reopen), m_fd(-1)
+  {
+    snprintf(m_export, sizeof(m_export), "%s/export", root);
+    snprintf(m_value, sizeof(m_value), "%s/gpio%d/value", root, gpio);
+    snprintf(m_direction, sizeof(m_direction), "%s/gpio%d/direction", root, gpio);
+  }
+  ~SysfsLine () { close(); }
+
+  bool open(int initial)
+  {
+    if(access(m_value, F_OK) != 0)
+    {
+      char number[16];
+      snprintf(number, sizeof(number), "%d", m_gpio);
+      if(!writeFile(m_export, number))
+      {
+        fprintf(stderr, "heartbeatd: cannot export gpio %d through %s: %s\n", m_gpio, m_export, strerror(errno));
+        return false;
+      }
+    }
+    for(int waited = 0; access(m_direction, W_OK) != 0 && waited < HB_EXPORT_WAIT; waited += 10)
+      usleep(10000);
+    // "high" and "low" set the direction and the level without a glitch
+    if(!writeFile(m_direction, initial ? "high" : "low"))
+    {
+      fprintf(stderr, "heartbeatd: cannot make gpio %d an output: %s\n", m_gpio, strerror(errno));
+      return false;
+    }
+    if(m_reopen)
+      return true;
+    m_fd = ::open(m_value, O_WRONLY);
+    if(m_fd < 0)
+    {
+      fprintf(stderr, "heartbeatd: cannot open %s: %s\n", m_value, strerror(errno));
+      return false;
+    }
+    return true;
+  }
+
+  bool set(int value)
+  {
+    if(m_reopen)
+      return setLikeR64(value);
+    return pwrite(m_fd, value ? "1" : "0", 1, 0) == 1;
+  }
+
+  void close()
+  {
+    if(m_fd >= 0)
+      ::close(m_fd);
+    m_fd = -1;
+  }
+
+  const char* name() const { return m_reopen ? "sysfs, reopened per toggle" : "sysfs"; }
+
+private:
+  // what R64.GPIO does for input() and output(): check the direction, read
+  // the level and write the new one, opening each file every time
+  bool setLikeR64(int value)
+  {
+    char buf[8];
+    const char* paths[2] = { m_direction, m_value };
+    for(int i = 0; i < 2; i++)
+    {
+      int fd = ::open(paths[i], O_RDONLY);
+      if(fd < 0)
+        return false;
+      ssize_t n = read(fd, buf, sizeof(buf));
+      ::close(fd);
+      if(n < 0)
+        return false;
+    }
+    int fd = ::open(m_value, O_WRONLY | O_TRUNC);
+    if(fd < 0)
+      return false;
+    bool ok = write(fd, value ? "1" : "0", 1) == 1;
+    ::close(fd);
+    return ok;
+  }
+
+  char m_export[HB_PATH_SIZE];
+  char m_value[HB_PATH_SIZE];
+  char m_direction[HB_PATH_SIZE];
+  int m_gpio;
+  bool m_reopen;
+  int m_fd;
+};
+
+// a line handle from /dev/gpiochipN, for kernels that have it
+class ChardevLine : public GpioLine
+{
+public:
+  ChardevLine (const char* chip, int line) : m_chip(chip), m_line(line), m_fd(-1) { }
+  ~ChardevLine () { close(); }
+
+  bool open(int initial)
+  {
+    int chip = ::open(m_chip, O_RDONLY);
+    if(chip < 0)
+    {
+      fprintf(stderr, "heartbeatd: cannot open %s: %s\n", m_chip, strerror(errno));
+      return false;
+    }
+    gpiohandle_request request;
+    memset(&request, 0, sizeof(request));
+    request.lineoffsets[0] = m_line;
+    request.lines = 1;
+    request.flags = GPIOHANDLE_REQUEST_OUTPUT;
+    request.default_values[0] = initial;
+    snprintf(request.consumer_label, sizeof(request.consumer_label), "heartbeatd");
+    int rc = ioctl(chip, GPIO_GET_LINEHANDLE_IOCTL, &request);
+    ::close(chip);
+    if(rc < 0)
+    {
+      fprintf(stderr, "heartbeatd: cannot request line %d of %s: %s\n", m_line, m_chip, strerror(errno));
+      return false;
+    }
+    m_fd = request.fd;
+    return true;
+  }
+
+  bool set(int value)
+  {
+    gpiohandle_data data;
+    memset(&data, 0, sizeof(data));
+    data.values[0] = value;
+    return ioctl(m_fd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data) == 0;
+  }
+
+  void close()
+  {
+    if(m_fd >= 0)
+      ::close(m_fd);
+    m_fd = -1;
+  }
+
+  const char* name() const { return "character device"; }
+
+private:
+  const char* m_chip;
+  int m_line;
+  int m_fd;
+};
+
+static void prefaultStack()
+{
+  volatile char stack[HB_STACK_PREFAULT];
+  for(size_t i = 0; i < sizeof(stack); i += 4096)
+    stack[i] = 0;
+}
+
+static void usage(const char* name)
+{
+  printf("usage: %s [-g gpio] [-s sysfs root] [-p period ms] [-f fifo priority] [-m]\n"
+         "       %s -c /dev/gpiochipN -l line [-p period ms] [-f fifo priority] [-m]\n"
+         "       add -b toggles to measure the jitter, -r to open the files per toggle like R64.GPIO\n", name, name);
+}
+
+static double cpuUs()
+{
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_utime.tv_sec * 1e6 + usage.ru_utime.tv_usec + usage.ru_stime.tv_sec * 1e6 + usage.ru_stime.tv_usec;
+}
+
+static unsigned long percentile(const std::vector<long>& sorted, double p)
+{
+  return sorted.empty() ? 0 : sorted[std::min(sorted.size() - 1, (size_t)(p * sorted.size()))];
+}
+
+int main(int argc, char** argv)
+{
+  int gpio = HB_DEFAULT_GPIO;
+  const char* sysfs = HB_DEFAULT_SYSFS;
+  const char* chip = NULL;
+  int line = -1;
+  unsigned long period = HB_DEFAULT_PERIOD;
+  int fifo = 0;
+  bool lock = false;
+  unsigned long bench = 0;
+  bool reopen = false;
+
+  int opt;
+  while((opt = getopt(argc, argv, "g:s:c:l:p:f:mb:rh")) != -1)
+  {
+    switch(opt)
+    {
+      case 'g': gpio = atoi(optarg); break;
+      case 's': sysfs = optarg; break;
+      case 'c': chip = optarg; break;
+      case 'l': line = atoi(optarg); break;
+      case 'p': period = strtoul(optarg, NULL, 10); break;
+      case 'f': fifo = atoi(optarg); break;
+      case 'm': lock = true; break;
+      case 'b': bench = strtoul(optarg, NULL, 10); break;
+      case 'r': reopen = true; break;
+      default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+    }
+  }
+  if(period < 1 || (chip && line < 0))
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  SysfsLine sysfsLine(sysfs, gpio, reopen);
+  ChardevLine chardevLine(chip ? chip : "", line);
+  GpioLine* gpioLine = chip ? static_cast<GpioLine*>(&chardevLine) : static_cast<GpioLine*>(&sysfsLine);
+
+  // everything the loop touches is allocated before the memory is locked
+  std::vector<long> lateness, writes;
+  lateness.reserve(bench);
+  writes.reserve(bench);
+
+  // wakeups may otherwise be deferred by 50 us to batch them with others
+  prctl(PR_SET_TIMERSLACK, 1UL);
+  if(fifo > 0)
+  {
+    sched_param param;
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = fifo;
+    if(sched_setscheduler(0, SCHED_FIFO, &param) != 0)
+      fprintf(stderr, "heartbeatd: SCHED_FIFO %d not available: %s\n", fifo, strerror(errno));
+  }
+  if(lock)
+  {
+    prefaultStack();
+    if(mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+      fprintf(stderr, "heartbeatd: mlockall failed: %s\n", strerror(errno));
+  }
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = onSignal;
+  sigaction(SIGTERM, &action, NULL);
+  sigaction(SIGINT, &action, NULL);
+  sigaction(SIGHUP, &action, NULL);
+
+  // starts high like heartbeat.py
+  int level = 1;
+  if(!gpioLine->open(level))
+    return 1;
+  fprintf(stderr, "heartbeatd: toggling %s %d every %lu ms through the %s\n",
+    chip ? chip : "gpio", chip ? line : gpio, period, gpioLine->name());
+
+  bool failing = false;
+  double cpuStart = cpuUs();
+  timespec next;
+  clock_gettime(CLOCK_MONOTONIC, &next);
+  while(!s_stop && (!bench || lateness.size() < bench))
+  {
+    addMs(next, period);
+    while(!s_stop && clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+      ;
+    if(s_stop)
+      break;
+    // systemctl reload, e.g. after the line was unexported; checked once per
+    // toggle, so a SIGHUP during the write is not missed
+    if(s_reopen)
+    {
+      s_reopen = 0;
+      gpioLine->close();
+      if(!gpioLine->open(level))
+        return 1;
+    }
+
+    timespec woken, written;
+    clock_gettime(CLOCK_MONOTONIC, &woken);
+    level = !level;
+    bool ok = gpioLine->set(level);
+    clock_gettime(CLOCK_MONOTONIC, &written);
+    // only the first of a series of failures goes to the journal
+    if(!ok && !failing)
+      fprintf(stderr, "heartbeatd: cannot write the line: %s\n", strerror(errno));
+    if(ok && failing)
+      fprintf(stderr, "heartbeatd: writing the line works again\n");
+    failing = !ok;
+    if(bench)
+    {
+      lateness.push_back(elapsedUs(next, written));
+      writes.push_back(elapsedUs(woken, written));
+    }
+
+    // after a stall of more than a period, such as a suspend, carry on from
+    // now instead of catching up with a burst of toggles
+    if(elapsedUs(next, written) > (long)period * 1000)
+      next = written;
+  }
+
+  if(bench && !lateness.empty())
+  {
+    double cpu = cpuUs() - cpuStart;
+    std::sort(lateness.begin(), lateness.end());
+    std::sort(writes.begin(), writes.end());
+    printf("%zu toggles every %lu ms through the %s\n", lateness.size(), period, gpioLine->name());
+    printf("lateness us: p50 %lu, p99 %lu, p99.9 %lu, max %lu\n",
+      percentile(lateness, 0.5), percentile(lateness, 0.99), percentile(lateness, 0.999), (unsigned long)lateness.back());
+    printf("write us:    p50 %lu, p99 %lu, max %lu\n",
+      percentile(writes, 0.5), percentile(writes, 0.99), (unsigned long)writes.back());
+    printf("cpu us per toggle: %.1f\n", cpu / lateness.size());
+  }
+  gpioLine->close();
+  return 0;
+}